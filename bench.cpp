@@ -0,0 +1,524 @@
+// Benchmark of the generators and transformations
+//
+// usage: bench [-n samples] [-t threads] [pattern]
+//
+// Every case matching pattern (a substring of its name, all cases by
+// default) draws samples samples on one thread and reports ns/sample,
+// samples/s and, if perf_event_open is available, cycles/sample. The
+// scaling cases are then run on 1, 2, 4, ... threads up to the number
+// of online cores (or threads) with one seed array per thread. The std::
+// cases are the <random> baseline with std::mt19937_64.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include <random>
+
+extern "C" {
+#include "TinyRNG.h"
+}
+
+#define NSAMPLES 10000000
+#define BLOCK 4096
+
+typedef struct {
+    uint32_t seeds[TINYRNG_PHILOX_WORDS];
+    xorshift32vecstate vec;
+    float u2f;
+    double u2d;
+    rngdist dist;
+    uint32_t alias[2 * 1024];
+    uint32_t words[BLOCK];
+    uint64_t dwords[BLOCK];
+    float fbuf[BLOCK];
+    double dbuf[BLOCK];
+    std::mt19937 mt32;
+    std::mt19937_64 mt64;
+    double a, b;
+    uint64_t stream;
+    double sum;
+} benchctx;
+
+typedef struct {
+    const char *name;
+    double a, b;
+    uint32_t (*prepare)(benchctx *c);
+    void (*run)(benchctx *c, uint32_t n);
+} benchcase;
+
+
+/*
+ * set-up
+ */
+static uint32_t prepareXorshift(benchctx *c) { return(seedfrom(c->seeds, 5, c->stream)); }
+static uint32_t prepareKiss(benchctx *c) { return(seedkissfrom(c->seeds, c->stream)); }
+static uint32_t prepareXorshift64w(benchctx *c) { return(seedxorshift64wfrom(c->seeds, c->stream)); }
+static uint32_t prepareKiss64w(benchctx *c) { return(seedkiss64wfrom(c->seeds, c->stream)); }
+static uint32_t prepareVec(benchctx *c) { return(seedxorshift32vecfrom(c->vec.seeds, c->stream)); }
+static uint32_t preparePhilox(benchctx *c) { return(seedphilox(c->seeds, c->stream, 0)); }
+static uint32_t prepareStd(benchctx *c) { c->mt32.seed(c->stream); c->mt64.seed(c->stream); return(TINYRNG_OK); }
+
+static uint32_t prepareAlias(benchctx *c) {
+    double w[1024];
+    uint32_t i;
+
+    for(i = 0; i < (uint32_t)c->a; i++) {
+        w[i] = 1.0 + i % 7;
+    }
+    prepareXorshift(c);
+    return(aliasinit(c->alias, w, (uint32_t)c->a));
+}
+
+#define PREPARE_DIST(fn, d) \
+    static uint32_t fn(benchctx *c) { prepareXorshift(c); return(distinit(&c->dist, d, c->a, c->b)); }
+PREPARE_DIST(prepareDistPoiss, TINYRNG_POISSON)
+PREPARE_DIST(prepareDistBino, TINYRNG_BINOMIAL)
+PREPARE_DIST(prepareDistGamma, TINYRNG_GAMMA)
+PREPARE_DIST(prepareDistBeta, TINYRNG_BETA)
+
+
+/*
+ * one sample per call
+ */
+#define SCALAR(fn, T, call) \
+    static void fn(benchctx *c, uint32_t n) { T x = 0; double s = 0; for(; n > 0; n--) { call; s += x; } c->sum += s; }
+
+SCALAR(runXorshift32, uint32_t, xorshift32(c->seeds, &x))
+SCALAR(runXorshift64, uint64_t, xorshift64(c->seeds, &x))
+SCALAR(runKiss32, uint32_t, kiss32(c->seeds, &x))
+SCALAR(runKiss64, uint64_t, kiss64(c->seeds, &x))
+SCALAR(runXorshift64w, uint64_t, xorshift64w(c->seeds, &x))
+SCALAR(runKiss64w, uint64_t, kiss64w(c->seeds, &x))
+SCALAR(runPhilox32, uint32_t, philox32(c->seeds, &x))
+SCALAR(runPhilox64, uint64_t, philox64(c->seeds, &x))
+
+SCALAR(runUnif32, float, unifrnd32(xorshift32, c->seeds, &x))
+SCALAR(runUnif64, double, unifrnd64(xorshift64, c->seeds, &x))
+SCALAR(runExp32, float, exprnd32(xorshift32, c->seeds, &x, c->a))
+SCALAR(runExp64, double, exprnd64(xorshift64, c->seeds, &x, c->a))
+SCALAR(runExpZig32, float, expzig32(xorshift32, c->seeds, &x, c->a))
+SCALAR(runExpZig64, double, expzig64(xorshift64, c->seeds, &x, c->a))
+SCALAR(runNorm32, float, normstdrnd32(xorshift32, c->seeds, &x, &c->u2f))
+SCALAR(runNorm64, double, normstdrnd64(xorshift64, c->seeds, &x, &c->u2d))
+SCALAR(runNormZig32, float, normstdzig32(xorshift32, c->seeds, &x))
+SCALAR(runNormZig64, double, normstdzig64(xorshift64, c->seeds, &x))
+SCALAR(runGamma32, float, gammarnd32(xorshift32, c->seeds, &x, &c->u2f, c->a, c->b))
+SCALAR(runGamma64, double, gammarnd64(xorshift64, c->seeds, &x, &c->u2d, c->a, c->b))
+SCALAR(runBeta32, float, betarnd32(xorshift32, c->seeds, &x, c->a, c->b))
+SCALAR(runBeta64, double, betarnd64(xorshift64, c->seeds, &x, c->a, c->b))
+SCALAR(runPoiss32, float, poissrnd32(xorshift32, c->seeds, &x, &c->u2f, c->a))
+SCALAR(runPoiss64, double, poissrnd64(xorshift64, c->seeds, &x, &c->u2d, c->a))
+SCALAR(runBernoulli64, uint64_t, bernoullirnd64(xorshift64, c->seeds, &x, c->b))
+SCALAR(runBino32, int32_t, binomialrnd32(xorshift32, c->seeds, &x, &c->u2f, (uint32_t)c->a, c->b))
+SCALAR(runBino64, int64_t, binomialrnd64(xorshift64, c->seeds, &x, &c->u2d, (uint64_t)c->a, c->b))
+SCALAR(runDist32, float, distrnd32(xorshift32, c->seeds, &c->dist, &x))
+SCALAR(runDist64, double, distrnd64(xorshift64, c->seeds, &c->dist, &x))
+SCALAR(runAlias32, uint32_t, aliasrnd32(xorshift32, c->seeds, c->alias, (uint32_t)c->a, &x))
+SCALAR(runUnifint32, float, unifrndint32(xorshift32, c->seeds, &x, 0.0f, (float)c->a); x = floorf(x))
+SCALAR(runBounded32, uint32_t, boundedrnd32(xorshift32, c->seeds, &x, (uint32_t)c->a))
+SCALAR(runBounded64, uint64_t, boundedrnd64(xorshift64, c->seeds, &x, (uint64_t)c->a))
+
+SCALAR(runStdMt32, uint32_t, x = c->mt32())
+SCALAR(runStdMt64, uint64_t, x = c->mt64())
+
+
+/*
+ * bulk calls of BLOCK samples
+ */
+#define BULK(fn, buf, call) \
+    static void fn(benchctx *c, uint32_t n) { \
+        uint32_t m; \
+        for(; n > 0; n -= m) { m = n < BLOCK ? n : BLOCK; call; c->sum += c->buf[m - 1]; } \
+    }
+
+BULK(runXorshift32fill, words, xorshift32fill(c->seeds, c->words, m))
+BULK(runXorshift64fill, dwords, xorshift64fill(c->seeds, c->dwords, m))
+BULK(runKiss32fill, words, kiss32fill(c->seeds, c->words, m))
+BULK(runKiss64fill, dwords, kiss64fill(c->seeds, c->dwords, m))
+BULK(runXorshift64wfill, dwords, xorshift64wfill(c->seeds, c->dwords, m))
+BULK(runKiss64wfill, dwords, kiss64wfill(c->seeds, c->dwords, m))
+BULK(runPhilox32fill, words, philox32fill(c->seeds, c->words, m))
+BULK(runPhilox64fill, dwords, philox64fill(c->seeds, c->dwords, m))
+BULK(runXorshift32vecfill, words, xorshift32vecfill(c->vec.seeds, c->words, m))
+
+BULK(runUnif32fill, fbuf, unifrnd32fill(xorshift32fill, c->seeds, c->fbuf, m))
+BULK(runUnif64fill, dbuf, unifrnd64fill(xorshift64fill, c->seeds, c->dbuf, m))
+BULK(runNorm32fill, fbuf, normstdrnd32fill(xorshift32fill, c->seeds, c->fbuf, m))
+BULK(runNorm64fill, dbuf, normstdrnd64fill(xorshift64fill, c->seeds, c->dbuf, m))
+BULK(runDist32fill, fbuf, distfill32(xorshift32, c->seeds, &c->dist, c->fbuf, m))
+BULK(runDist64fill, dbuf, distfill64(xorshift64, c->seeds, &c->dist, c->dbuf, m))
+BULK(runRej32fill, fbuf, rejfill32(xorshift32fill, c->seeds, &c->dist, c->fbuf, m))
+BULK(runRej64fill, dbuf, rejfill64(xorshift64fill, c->seeds, &c->dist, c->dbuf, m))
+BULK(runBernoulli64fill, dwords, bernoullifill64(xorshift64fill, c->seeds, c->dwords, m, c->b))
+BULK(runAlias32fill, words, aliasfill32(xorshift32fill, c->seeds, c->alias, (uint32_t)c->a, c->words, m))
+BULK(runBounded32fill, words, boundedfill32(xorshift32fill, c->seeds, c->words, m, (uint32_t)c->a))
+BULK(runBounded64fill, dwords, boundedfill64(xorshift64fill, c->seeds, c->dwords, m, (uint64_t)c->a))
+
+
+/*
+ * sampling without replacement, b out of a per call, time per index
+ */
+static void runFloyd32(benchctx *c, uint32_t n) {
+    uint32_t m;
+
+    for(; n > 0; n -= m) {
+        m = n < (uint32_t)c->b ? n : (uint32_t)c->b;
+        samplefloyd32(xorshift32, c->seeds, c->words, m, (uint32_t)c->a);
+        c->sum += c->words[m - 1];
+    }
+}
+
+static void runSelect64(benchctx *c, uint32_t n) {
+    rngselect s;
+    uint32_t m;
+
+    for(; n > 0; n -= m) {
+        m = n < (uint32_t)c->b ? n : (uint32_t)c->b;
+        selectinit(&s, (uint64_t)c->b, (uint64_t)c->a);
+        selectfill64(xorshift64, c->seeds, &s, c->dwords, m);
+        c->sum += c->dwords[m - 1];
+    }
+}
+
+
+/*
+ * <random> baseline, the distribution is constructed once per run
+ */
+#define STD(fn, T, dist) \
+    static void fn(benchctx *c, uint32_t n) { T x = 0; double s = 0; dist; for(; n > 0; n--) { x = d(c->mt64); s += x; } c->sum += s; }
+
+STD(runStdUnif, double, std::uniform_real_distribution<double> d(0.0, 1.0))
+STD(runStdExp, double, std::exponential_distribution<double> d(c->a))
+STD(runStdNorm, double, std::normal_distribution<double> d(0.0, 1.0))
+STD(runStdGamma, double, std::gamma_distribution<double> d(c->a, c->b))
+STD(runStdPoiss, long, std::poisson_distribution<long> d(c->a))
+STD(runStdBino, long, std::binomial_distribution<long> d((long)c->a, c->b))
+STD(runStdInt, uint64_t, std::uniform_int_distribution<uint64_t> d(0, (uint64_t)c->a - 1))
+
+
+static const benchcase cases[] = {
+    // generators
+    {"xorshift32", 0, 0, prepareXorshift, runXorshift32},
+    {"xorshift64", 0, 0, prepareXorshift, runXorshift64},
+    {"kiss32", 0, 0, prepareKiss, runKiss32},
+    {"kiss64", 0, 0, prepareKiss, runKiss64},
+    {"xorshift64w", 0, 0, prepareXorshift64w, runXorshift64w},
+    {"kiss64w", 0, 0, prepareKiss64w, runKiss64w},
+    {"xorshift32fill", 0, 0, prepareXorshift, runXorshift32fill},
+    {"xorshift64fill", 0, 0, prepareXorshift, runXorshift64fill},
+    {"kiss32fill", 0, 0, prepareKiss, runKiss32fill},
+    {"kiss64fill", 0, 0, prepareKiss, runKiss64fill},
+    {"xorshift64wfill", 0, 0, prepareXorshift64w, runXorshift64wfill},
+    {"kiss64wfill", 0, 0, prepareKiss64w, runKiss64wfill},
+    {"xorshift32vecfill", 0, 0, prepareVec, runXorshift32vecfill},
+    {"philox32", 0, 0, preparePhilox, runPhilox32},
+    {"philox64", 0, 0, preparePhilox, runPhilox64},
+    {"philox32fill", 0, 0, preparePhilox, runPhilox32fill},
+    {"philox64fill", 0, 0, preparePhilox, runPhilox64fill},
+    {"std::mt19937", 0, 0, prepareStd, runStdMt32},
+    {"std::mt19937_64", 0, 0, prepareStd, runStdMt64},
+
+    // transformations, 32-bit on xorshift32 and 64-bit on xorshift64
+    {"unifrnd32", 0, 0, prepareXorshift, runUnif32},
+    {"unifrnd64", 0, 0, prepareXorshift, runUnif64},
+    {"unifrnd32fill", 0, 0, prepareXorshift, runUnif32fill},
+    {"unifrnd64fill", 0, 0, prepareXorshift, runUnif64fill},
+    {"std::uniform_real_distribution", 0, 0, prepareStd, runStdUnif},
+    {"exprnd32", 1, 0, prepareXorshift, runExp32},
+    {"exprnd64", 1, 0, prepareXorshift, runExp64},
+    {"expzig32", 1, 0, prepareXorshift, runExpZig32},
+    {"expzig64", 1, 0, prepareXorshift, runExpZig64},
+    {"std::exponential_distribution", 1, 0, prepareStd, runStdExp},
+    {"normstdrnd32", 0, 0, prepareXorshift, runNorm32},
+    {"normstdrnd64", 0, 0, prepareXorshift, runNorm64},
+    {"normstdrnd32fill", 0, 0, prepareXorshift, runNorm32fill},
+    {"normstdrnd64fill", 0, 0, prepareXorshift, runNorm64fill},
+    {"normstdzig32", 0, 0, prepareXorshift, runNormZig32},
+    {"normstdzig64", 0, 0, prepareXorshift, runNormZig64},
+    {"std::normal_distribution", 0, 0, prepareStd, runStdNorm},
+    {"gammarnd32 alpha=0.5", 0.5, 1, prepareXorshift, runGamma32},
+    {"gammarnd64 alpha=0.5", 0.5, 1, prepareXorshift, runGamma64},
+    {"gammarnd32 alpha=3", 3, 1, prepareXorshift, runGamma32},
+    {"gammarnd64 alpha=3", 3, 1, prepareXorshift, runGamma64},
+    {"distrnd64 gamma alpha=3", 3, 1, prepareDistGamma, runDist64},
+    {"rejfill32 gamma alpha=0.5", 0.5, 1, prepareDistGamma, runRej32fill},
+    {"rejfill64 gamma alpha=0.5", 0.5, 1, prepareDistGamma, runRej64fill},
+    {"rejfill32 gamma alpha=3", 3, 1, prepareDistGamma, runRej32fill},
+    {"rejfill64 gamma alpha=3", 3, 1, prepareDistGamma, runRej64fill},
+    {"std::gamma_distribution alpha=0.5", 0.5, 1, prepareStd, runStdGamma},
+    {"std::gamma_distribution alpha=3", 3, 1, prepareStd, runStdGamma},
+    {"betarnd32 2,5", 2, 5, prepareXorshift, runBeta32},
+    {"betarnd64 2,5", 2, 5, prepareXorshift, runBeta64},
+    {"distrnd64 beta 2,5", 2, 5, prepareDistBeta, runDist64},
+    {"rejfill32 beta 2,5", 2, 5, prepareDistBeta, runRej32fill},
+    {"rejfill64 beta 2,5", 2, 5, prepareDistBeta, runRej64fill},
+    {"poissrnd32 lambda=5", 5, 0, prepareXorshift, runPoiss32},
+    {"poissrnd64 lambda=5", 5, 0, prepareXorshift, runPoiss64},
+    {"distrnd64 poisson lambda=5", 5, 0, prepareDistPoiss, runDist64},
+    {"std::poisson_distribution lambda=5", 5, 0, prepareStd, runStdPoiss},
+    {"poissrnd32 lambda=50", 50, 0, prepareXorshift, runPoiss32},
+    {"poissrnd64 lambda=50", 50, 0, prepareXorshift, runPoiss64},
+    {"distrnd64 poisson lambda=50", 50, 0, prepareDistPoiss, runDist64},
+    {"distfill32 poisson lambda=50", 50, 0, prepareDistPoiss, runDist32fill},
+    {"distfill64 poisson lambda=50", 50, 0, prepareDistPoiss, runDist64fill},
+    {"rejfill32 poisson lambda=50", 50, 0, prepareDistPoiss, runRej32fill},
+    {"rejfill64 poisson lambda=50", 50, 0, prepareDistPoiss, runRej64fill},
+    {"std::poisson_distribution lambda=50", 50, 0, prepareStd, runStdPoiss},
+    {"poissrnd32 lambda=500", 500, 0, prepareXorshift, runPoiss32},
+    {"poissrnd64 lambda=500", 500, 0, prepareXorshift, runPoiss64},
+    {"distrnd32 poisson lambda=500", 500, 0, prepareDistPoiss, runDist32},
+    {"distrnd64 poisson lambda=500", 500, 0, prepareDistPoiss, runDist64},
+    {"std::poisson_distribution lambda=500", 500, 0, prepareStd, runStdPoiss},
+    {"bernoullirnd64 p=0.3, 64 trials", 0, 0.3, prepareXorshift, runBernoulli64},
+    {"bernoullifill64 p=0.3, per trial", 0, 0.3, prepareXorshift, runBernoulli64fill},
+    {"binomialrnd32 n=5", 5, 0.3, prepareXorshift, runBino32},
+    {"binomialrnd64 n=5", 5, 0.3, prepareXorshift, runBino64},
+    {"distrnd64 binomial n=5", 5, 0.3, prepareDistBino, runDist64},
+    {"std::binomial_distribution n=5", 5, 0.3, prepareStd, runStdBino},
+    {"binomialrnd32 n=100", 100, 0.3, prepareXorshift, runBino32},
+    {"binomialrnd64 n=100", 100, 0.3, prepareXorshift, runBino64},
+    {"distrnd64 binomial n=100", 100, 0.3, prepareDistBino, runDist64},
+    {"std::binomial_distribution n=100", 100, 0.3, prepareStd, runStdBino},
+    {"binomialrnd32 n=100000", 100000, 0.3, prepareXorshift, runBino32},
+    {"binomialrnd64 n=100000", 100000, 0.3, prepareXorshift, runBino64},
+    {"distrnd32 binomial n=100000", 100000, 0.3, prepareDistBino, runDist32},
+    {"distrnd64 binomial n=100000", 100000, 0.3, prepareDistBino, runDist64},
+    {"distfill64 binomial n=100000", 100000, 0.3, prepareDistBino, runDist64fill},
+    {"std::binomial_distribution n=100000", 100000, 0.3, prepareStd, runStdBino},
+    {"aliasrnd32 k=16", 16, 0, prepareAlias, runAlias32},
+    {"aliasrnd32 k=1024", 1024, 0, prepareAlias, runAlias32},
+    {"aliasfill32 k=1024", 1024, 0, prepareAlias, runAlias32fill},
+    {"unifrndint32 floor, n=1000", 1000, 0, prepareXorshift, runUnifint32},
+    {"boundedrnd32 n=1000", 1000, 0, prepareXorshift, runBounded32},
+    {"boundedrnd64 n=1000", 1000, 0, prepareXorshift, runBounded64},
+    {"boundedfill32 n=1000", 1000, 0, prepareXorshift, runBounded32fill},
+    {"boundedfill64 n=1000", 1000, 0, prepareXorshift, runBounded64fill},
+    {"std::uniform_int_distribution n=1000", 1000, 0, prepareStd, runStdInt},
+    {"samplefloyd32 1000 of 1e9, per index", 1e9, 1000, prepareXorshift, runFloyd32},
+    {"selectnext64 1000 of 1e9, per index", 1e9, 1000, prepareXorshift, runSelect64},
+};
+
+// cases run on 1 to N threads
+static const char *scaling[] = {
+    "xorshift32fill",
+    "normstdrnd64fill",
+    "poissrnd64 lambda=50",
+    "binomialrnd64 n=100000",
+    "std::mt19937_64",
+    "std::normal_distribution",
+};
+
+#define NCASES (sizeof(cases) / sizeof(cases[0]))
+#define NSCALING (sizeof(scaling) / sizeof(scaling[0]))
+
+
+/*
+ * timing
+ */
+static double now() {
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return(t.tv_sec + 1e-9 * t.tv_nsec);
+}
+
+
+// cycle counter of the calling thread, -1 if perf_event_open is not permitted
+static int cyclesOpen() {
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CPU_CYCLES;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return((int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+
+// set up case b on its own stream
+static benchctx *ctxNew(const benchcase *b, uint64_t stream) {
+    benchctx *c = new benchctx();
+
+    c->u2f = NAN;
+    c->u2d = NAN;
+    c->a = b->a;
+    c->b = b->b;
+    c->stream = stream;
+    if(b->prepare(c) != TINYRNG_OK) {
+        delete c;
+        return(NULL);
+    }
+    return(c);
+}
+
+
+/*
+ * threads
+ */
+typedef struct {
+    const benchcase *b;
+    benchctx *c;
+    uint32_t n;
+    pthread_barrier_t *start;
+} benchthread;
+
+
+static void *threadRun(void *arg) {
+    benchthread *t = (benchthread *)arg;
+
+    pthread_barrier_wait(t->start);
+    t->b->run(t->c, t->n);
+    return(NULL);
+}
+
+
+// aggregate samples/s of nthreads threads drawing n samples each
+static double runThreads(const benchcase *b, uint32_t nthreads, uint32_t n) {
+    pthread_t *ids = new pthread_t[nthreads];
+    benchthread *t = new benchthread[nthreads];
+    pthread_barrier_t start;
+    double t0, t1;
+    uint32_t i;
+
+    pthread_barrier_init(&start, NULL, nthreads + 1);
+    for(i = 0; i < nthreads; i++) {
+        t[i].b = b;
+        t[i].c = ctxNew(b, i + 1);
+        t[i].n = n;
+        t[i].start = &start;
+        pthread_create(&ids[i], NULL, threadRun, &t[i]);
+    }
+    pthread_barrier_wait(&start);
+    t0 = now();
+    for(i = 0; i < nthreads; i++) {
+        pthread_join(ids[i], NULL);
+    }
+    t1 = now();
+
+    for(i = 0; i < nthreads; i++) {
+        delete t[i].c;
+    }
+    pthread_barrier_destroy(&start);
+    delete[] t;
+    delete[] ids;
+    return((double)nthreads * n / (t1 - t0));
+}
+
+
+int main(int argc, char **argv) {
+    const char *pattern = NULL;
+    uint32_t n = NSAMPLES;
+    uint32_t maxthreads = (uint32_t)sysconf(_SC_NPROCESSORS_ONLN);
+    uint32_t i, k;
+    long long cycles;
+    double t0, t1, single;
+    double sum = 0.0;
+    benchctx *c;
+    int fd, opt;
+
+    while((opt = getopt(argc, argv, "n:t:")) != -1) {
+        switch(opt) {
+            case 'n': n = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 't': maxthreads = (uint32_t)strtoul(optarg, NULL, 10); break;
+            default:
+                fprintf(stderr, "usage: %s [-n samples] [-t threads] [pattern]\n", argv[0]);
+                return(1);
+        }
+    }
+    if(optind < argc) {
+        pattern = argv[optind];
+    }
+    if(n == 0 || maxthreads == 0) {
+        fprintf(stderr, "samples and threads must be positive\n");
+        return(1);
+    }
+
+    fd = cyclesOpen();
+    printf("%u samples per case, cycles %s\n\n", n, fd < 0 ? "not available (perf_event_open)" : "from perf_event_open");
+    printf("%-40s %10s %14s %12s\n", "case", "ns/sample", "samples/s", "cycles/sample");
+
+    for(i = 0; i < NCASES; i++) {
+        if(pattern != NULL && strstr(cases[i].name, pattern) == NULL) {
+            continue;
+        }
+        c = ctxNew(&cases[i], 1);
+        if(c == NULL) {
+            printf("%-40s set-up failed\n", cases[i].name);
+            continue;
+        }
+
+        // warm up caches, tables and the branch predictors
+        cases[i].run(c, n / 100 + 1);
+
+        cycles = -1;
+        if(fd >= 0) {
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+        t0 = now();
+        cases[i].run(c, n);
+        t1 = now();
+        if(fd >= 0) {
+            ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+            if(read(fd, &cycles, sizeof(cycles)) != sizeof(cycles)) {
+                cycles = -1;
+            }
+        }
+
+        if(cycles >= 0) {
+            printf("%-40s %10.2f %14.4e %12.2f\n", cases[i].name, 1e9 * (t1 - t0) / n, n / (t1 - t0), (double)cycles / n);
+        } else {
+            printf("%-40s %10.2f %14.4e %12s\n", cases[i].name, 1e9 * (t1 - t0) / n, n / (t1 - t0), "-");
+        }
+        sum += c->sum;
+        delete c;
+    }
+    if(fd >= 0) {
+        close(fd);
+    }
+
+    // thread scaling, aggregate throughput and parallel efficiency
+    printf("\n%-40s %8s %14s %10s\n", "scaling", "threads", "samples/s", "efficiency");
+    for(i = 0; i < NSCALING; i++) {
+        const benchcase *b = NULL;
+
+        for(k = 0; k < NCASES; k++) {
+            if(strcmp(cases[k].name, scaling[i]) == 0) {
+                b = &cases[k];
+            }
+        }
+        if(b == NULL || (pattern != NULL && strstr(b->name, pattern) == NULL)) {
+            continue;
+        }
+
+        single = 0.0;
+        for(k = 1; ; k = (2 * k > maxthreads && k < maxthreads) ? maxthreads : 2 * k) {
+            double rate = runThreads(b, k, n);
+
+            if(k == 1) {
+                single = rate;
+            }
+            printf("%-40s %8u %14.4e %9.1f%%\n", b->name, k, rate, 100.0 * rate / (k * single));
+            if(k >= maxthreads) {
+                break;
+            }
+        }
+    }
+
+    // keep the samples alive
+    if(sum == 1.0) {
+        printf("\n");
+    }
+    return(0);
+}
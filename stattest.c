@@ -0,0 +1,988 @@
+// Statistical tests of the transformations
+//
+// usage: stattest [-n samples] [-t threads] [-a alpha] [-s seed] [pattern]
+//
+// Every case matching pattern (a substring of its name, all cases by
+// default) draws samples samples, 10^8 by default, split over threads
+// threads with one stream each. The samples are never stored, they are
+// streamed through
+//
+//   * a KS test: the samples are mapped by the analytic CDF to [0, 1)
+//     and counted in 2^16 bins, the KS distance is taken at the bin edges,
+//   * a chi-square test on 1024 equiprobable classes of these bins, or
+//     on the pmf for the discrete distributions (tails pooled until
+//     every class expects at least 5 samples),
+//   * z-tests of the mean and the variance against the analytic values,
+//     the standard error of the variance from the sample fourth moment.
+//
+// A case fails if any p-value is below alpha, 1e-6 by default, or NaN.
+//
+// The checks after the cases test properties other than a distribution,
+// e.g. that parfill gives the same samples on any number of threads,
+// and sampling without replacement: a chi-square over all k-subsets,
+// the inclusion count of every value, ascending indices in range from
+// selectfill64 and the argument errors. The sampling checks draw at
+// most 10^7 subsets on one thread. They match pattern the same way. The exit status is the number of
+// failed cases and checks (at most 255), so 0 if all pass.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "TinyRNG.h"
+
+#define NSAMPLES 100000000ULL
+#define BLOCK 4096
+#define KSBINS 65536
+#define CHIBINS 1024
+#define ALPHA 1e-6
+
+// distribution families
+#define UNIF 1
+#define EXP 2
+#define NORM 3
+#define GAMMA 4
+#define BETA 5
+#define POISS 6
+#define BINO 7
+#define ALIAS 8
+#define INT 9
+
+typedef struct {
+    uint32_t seeds[TINYRNG_PHILOX_WORDS];
+    xorshift32vecstate vec;
+    float u2f;
+    double u2d;
+    rngdist dist;
+    uint32_t *alias;
+    float fbuf[BLOCK];
+    double dbuf[BLOCK];
+    int32_t ibuf[BLOCK];
+    uint64_t wbuf[BLOCK];
+    double a, b;
+} drawctx;
+
+typedef struct {
+    const char *name;
+    uint32_t family;
+    double a, b;
+    uint32_t generator;
+    void (*draw)(drawctx *c, double *x, uint32_t n);
+} statcase;
+
+
+/*
+ * Special functions
+ */
+
+// regularized lower incomplete gamma P(a, x) and upper Q(a, x) = 1 - P(a, x)
+static double incgamma(double a, double x, uint32_t upper) {
+    double sum, del, ap, b, c, d, h, an, lg;
+    uint32_t i;
+
+    if(x <= 0.0) {
+        return(upper ? 1.0 : 0.0);
+    }
+    lg = a * log(x) - x - lgamma(a);
+
+    // series
+    if(x < a + 1.0) {
+        ap = a;
+        sum = del = 1.0 / a;
+        for(i = 0; i < 100000; i++) {
+            ap += 1.0;
+            del *= x / ap;
+            sum += del;
+            if(fabs(del) < fabs(sum) * 1e-16) {
+                break;
+            }
+        }
+        sum *= exp(lg);
+        return(upper ? 1.0 - sum : sum);
+    }
+
+    // continued fraction, modified Lentz
+    b = x + 1.0 - a;
+    c = 1.0 / 1e-300;
+    d = 1.0 / b;
+    h = d;
+    for(i = 1; i < 100000; i++) {
+        an = -(double)i * (i - a);
+        b += 2.0;
+        d = an * d + b;
+        if(fabs(d) < 1e-300) {
+            d = 1e-300;
+        }
+        c = b + an / c;
+        if(fabs(c) < 1e-300) {
+            c = 1e-300;
+        }
+        d = 1.0 / d;
+        del = d * c;
+        h *= del;
+        if(fabs(del - 1.0) < 1e-16) {
+            break;
+        }
+    }
+    h *= exp(lg);
+    return(upper ? h : 1.0 - h);
+}
+
+
+// continued fraction of the incomplete beta function
+static double betacf(double a, double b, double x) {
+    double c = 1.0, d, h, aa, del;
+    uint32_t m;
+
+    d = 1.0 - (a + b) * x / (a + 1.0);
+    if(fabs(d) < 1e-300) {
+        d = 1e-300;
+    }
+    d = 1.0 / d;
+    h = d;
+    for(m = 1; m < 100000; m++) {
+        aa = m * (b - m) * x / ((a + 2 * m - 1) * (a + 2 * m));
+        d = 1.0 + aa * d;
+        d = fabs(d) < 1e-300 ? 1e-300 : d;
+        c = 1.0 + aa / c;
+        c = fabs(c) < 1e-300 ? 1e-300 : c;
+        d = 1.0 / d;
+        h *= d * c;
+
+        aa = -(a + m) * (a + b + m) * x / ((a + 2 * m) * (a + 2 * m + 1));
+        d = 1.0 + aa * d;
+        d = fabs(d) < 1e-300 ? 1e-300 : d;
+        c = 1.0 + aa / c;
+        c = fabs(c) < 1e-300 ? 1e-300 : c;
+        d = 1.0 / d;
+        del = d * c;
+        h *= del;
+        if(fabs(del - 1.0) < 1e-16) {
+            break;
+        }
+    }
+    return(h);
+}
+
+
+// regularized incomplete beta I_x(a, b)
+static double incbeta(double a, double b, double x) {
+    double f;
+
+    if(x <= 0.0) {
+        return(0.0);
+    }
+    if(x >= 1.0) {
+        return(1.0);
+    }
+    f = exp(lgamma(a + b) - lgamma(a) - lgamma(b) + a * log(x) + b * log1p(-x));
+    if(x < (a + 1.0) / (a + b + 2.0)) {
+        return(f * betacf(a, b, x) / a);
+    }
+    return(1.0 - f * betacf(b, a, 1.0 - x) / b);
+}
+
+
+// P(sqrt(n) D > lambda) of the Kolmogorov distribution
+static double kolmogorov(double lambda) {
+    double sum = 0.0, term;
+    uint32_t k;
+
+    if(lambda < 0.2) {
+        return(1.0);
+    }
+    for(k = 1; k < 100; k++) {
+        term = exp(-2.0 * k * k * lambda * lambda);
+        sum += (k & 1) ? term : -term;
+        if(term < 1e-300) {
+            break;
+        }
+    }
+    sum *= 2.0;
+    return(sum < 0.0 ? 0.0 : (sum > 1.0 ? 1.0 : sum));
+}
+
+
+/*
+ * Analytic distributions
+ */
+
+// alias cases draw from the weights 1 + i % 7, i = 0 .. k - 1
+static double aliasWeight(uint32_t i) { return(1.0 + i % 7); }
+
+
+static double aliasTotal(uint32_t k) {
+    double s = 0.0;
+    uint32_t i;
+
+    for(i = 0; i < k; i++) {
+        s += aliasWeight(i);
+    }
+    return(s);
+}
+
+
+static double cdf(uint32_t family, double a, double b, double x) {
+    switch(family) {
+        case UNIF: return(x <= 0.0 ? 0.0 : (x >= 1.0 ? 1.0 : x));
+        case EXP: return(x <= 0.0 ? 0.0 : -expm1(-a * x));
+        case NORM: return(0.5 * erfc(-(x - a) / (b * M_SQRT2)));
+        case GAMMA: return(incgamma(a, x / b, 0));
+        case BETA: return(incbeta(a, b, x));
+    }
+    return(NAN);
+}
+
+
+static double pmf(uint32_t family, double a, double b, int64_t k) {
+    switch(family) {
+        case POISS:
+            return(exp(k * log(a) - a - lgamma(k + 1.0)));
+        case BINO:
+            if(k < 0 || k > (int64_t)a) {
+                return(0.0);
+            }
+            if(b == 0.0 || b == 1.0) {
+                return((b == 0.0) == (k == 0) ? 1.0 : 0.0);
+            }
+            return(exp(lgamma(a + 1.0) - lgamma(k + 1.0) - lgamma(a - k + 1.0) + k * log(b) + (a - k) * log1p(-b)));
+        case ALIAS:
+            return((k < 0 || k >= (int64_t)a) ? 0.0 : aliasWeight((uint32_t)k) / aliasTotal((uint32_t)a));
+        case INT:
+            return((k < 0 || k >= (int64_t)a) ? 0.0 : 1.0 / a);
+    }
+    return(NAN);
+}
+
+
+static void moments(uint32_t family, double a, double b, double *mean, double *var) {
+    double s, m, v;
+    uint32_t i;
+
+    *mean = *var = NAN;
+    switch(family) {
+        case UNIF: *mean = 0.5; *var = 1.0 / 12.0; break;
+        case EXP: *mean = 1.0 / a; *var = 1.0 / (a * a); break;
+        case NORM: *mean = a; *var = b * b; break;
+        case GAMMA: *mean = a * b; *var = a * b * b; break;
+        case BETA: *mean = a / (a + b); *var = a * b / ((a + b) * (a + b) * (a + b + 1.0)); break;
+        case POISS: *mean = a; *var = a; break;
+        case BINO: *mean = a * b; *var = a * b * (1.0 - b); break;
+        case ALIAS:
+            s = aliasTotal((uint32_t)a);
+            m = v = 0.0;
+            for(i = 0; i < (uint32_t)a; i++) {
+                m += i * aliasWeight(i) / s;
+                v += (double)i * i * aliasWeight(i) / s;
+            }
+            *mean = m;
+            *var = v - m * m;
+            break;
+        case INT: *mean = 0.5 * (a - 1.0); *var = (a * a - 1.0) / 12.0; break;
+    }
+}
+
+
+/*
+ * Samplers, n <= BLOCK samples converted to double
+ */
+#define SCALAR(fn, T, call) \
+    static void fn(drawctx *c, double *x, uint32_t n) { T s; uint32_t i; for(i = 0; i < n; i++) { call; x[i] = (double)s; } }
+
+#define BULK(fn, buf, call) \
+    static void fn(drawctx *c, double *x, uint32_t n) { uint32_t i; call; for(i = 0; i < n; i++) { x[i] = (double)c->buf[i]; } }
+
+SCALAR(drawUnif32, float, unifrnd32(xorshift32, c->seeds, &s))
+SCALAR(drawUnif64, double, unifrnd64(xorshift64, c->seeds, &s))
+SCALAR(drawUnif32Kiss, float, unifrnd32(kiss32, c->seeds, &s))
+SCALAR(drawUnif64Kiss, double, unifrnd64(kiss64, c->seeds, &s))
+SCALAR(drawUnif64Xorshift64w, double, unifrnd64(xorshift64w, c->seeds, &s))
+SCALAR(drawUnif64Kiss64w, double, unifrnd64(kiss64w, c->seeds, &s))
+BULK(drawUnif32fill, fbuf, unifrnd32fill(xorshift32fill, c->seeds, c->fbuf, n))
+BULK(drawUnif64fill, dbuf, unifrnd64fill(xorshift64fill, c->seeds, c->dbuf, n))
+SCALAR(drawUnif64Philox, double, unifrnd64(philox64, c->seeds, &s))
+BULK(drawUnif32philoxfill, fbuf, unifrnd32fill(philox32fill, c->seeds, c->fbuf, n))
+BULK(drawUnif32vecfill, fbuf, unifrnd32fill(xorshift32vecfill, c->vec.seeds, c->fbuf, n))
+SCALAR(drawExp32, float, exprnd32(xorshift32, c->seeds, &s, c->a))
+SCALAR(drawExp64, double, exprnd64(xorshift64, c->seeds, &s, c->a))
+SCALAR(drawExpZig32, float, expzig32(xorshift32, c->seeds, &s, c->a))
+SCALAR(drawExpZig64, double, expzig64(xorshift64, c->seeds, &s, c->a))
+SCALAR(drawNorm32, float, normrnd32(xorshift32, c->seeds, &s, &c->u2f, c->a, c->b))
+SCALAR(drawNorm64, double, normrnd64(xorshift64, c->seeds, &s, &c->u2d, c->a, c->b))
+BULK(drawNormstd32fill, fbuf, normstdrnd32fill(xorshift32fill, c->seeds, c->fbuf, n))
+BULK(drawNormstd64fill, dbuf, normstdrnd64fill(xorshift64fill, c->seeds, c->dbuf, n))
+SCALAR(drawNormZig32, float, normzig32(xorshift32, c->seeds, &s, c->a, c->b))
+SCALAR(drawNormZig64, double, normzig64(xorshift64, c->seeds, &s, c->a, c->b))
+SCALAR(drawGamma32, float, gammarnd32(xorshift32, c->seeds, &s, &c->u2f, c->a, c->b))
+SCALAR(drawGamma64, double, gammarnd64(xorshift64, c->seeds, &s, &c->u2d, c->a, c->b))
+SCALAR(drawBeta32, float, betarnd32(xorshift32, c->seeds, &s, c->a, c->b))
+SCALAR(drawBeta64, double, betarnd64(xorshift64, c->seeds, &s, c->a, c->b))
+SCALAR(drawPoiss32, float, poissrnd32(xorshift32, c->seeds, &s, &c->u2f, c->a))
+SCALAR(drawPoiss64, double, poissrnd64(xorshift64, c->seeds, &s, &c->u2d, c->a))
+SCALAR(drawBino32, int32_t, binomialrnd32(xorshift32, c->seeds, &s, &c->u2f, (uint32_t)c->a, c->b))
+SCALAR(drawBino64, int64_t, binomialrnd64(xorshift64, c->seeds, &s, &c->u2d, (uint64_t)c->a, c->b))
+SCALAR(drawDist32, float, distrnd32(xorshift32, c->seeds, &c->dist, &s))
+SCALAR(drawDist64, double, distrnd64(xorshift64, c->seeds, &c->dist, &s))
+BULK(drawDist32fill, fbuf, distfill32(xorshift32, c->seeds, &c->dist, c->fbuf, n))
+BULK(drawDist64fill, dbuf, distfill64(xorshift64, c->seeds, &c->dist, c->dbuf, n))
+BULK(drawRej32fill, fbuf, rejfill32(xorshift32fill, c->seeds, &c->dist, c->fbuf, n))
+BULK(drawRej64fill, dbuf, rejfill64(xorshift64fill, c->seeds, &c->dist, c->dbuf, n))
+// Bernoulli words counted, Binomial(64, p) and Binomial(32, p) per word
+static uint32_t bernoulliCount64(drawctx *c, int32_t *s) {
+    uint64_t w = 0;
+    uint32_t _err = bernoullirnd64(xorshift64, c->seeds, &w, c->b);
+
+    *s = __builtin_popcountll(w);
+    return(_err);
+}
+
+static void drawBernoulli32fill(drawctx *c, double *x, uint32_t n) {
+    uint32_t i;
+
+    bernoullifill32(xorshift32fill, c->seeds, (uint32_t *)c->ibuf, 32 * n, c->b);
+    for(i = 0; i < n; i++) {
+        x[i] = __builtin_popcount((uint32_t)c->ibuf[i]);
+    }
+}
+
+SCALAR(drawBernoulli64, int32_t, bernoulliCount64(c, &s))
+SCALAR(drawAlias32, uint32_t, aliasrnd32(xorshift32, c->seeds, c->alias, (uint32_t)c->a, &s))
+BULK(drawAlias32fill, ibuf, aliasfill32(xorshift32fill, c->seeds, c->alias, (uint32_t)c->a, (uint32_t *)c->ibuf, n))
+SCALAR(drawBounded32, uint32_t, boundedrnd32(xorshift32, c->seeds, &s, (uint32_t)c->a))
+SCALAR(drawBounded64, uint64_t, boundedrnd64(xorshift64w, c->seeds, &s, (uint64_t)c->a))
+BULK(drawBounded32fill, ibuf, boundedfill32(xorshift32fill, c->seeds, (uint32_t *)c->ibuf, n, (uint32_t)c->a))
+BULK(drawBounded64fill, wbuf, boundedfill64(xorshift64fill, c->seeds, c->wbuf, n, (uint64_t)c->a))
+
+// generator of a case, selects the seeding of the per thread streams
+#define GEN_XORSHIFT 0
+#define GEN_KISS 1
+#define GEN_XORSHIFT64W 2
+#define GEN_KISS64W 3
+#define GEN_VEC 4
+#define GEN_DIST 5
+#define GEN_PHILOX 6
+
+static const statcase cases[] = {
+    {"unifrnd32", UNIF, 0, 0, GEN_XORSHIFT, drawUnif32},
+    {"unifrnd64", UNIF, 0, 0, GEN_XORSHIFT, drawUnif64},
+    {"unifrnd32 kiss32", UNIF, 0, 0, GEN_KISS, drawUnif32Kiss},
+    {"unifrnd64 kiss64", UNIF, 0, 0, GEN_KISS, drawUnif64Kiss},
+    {"unifrnd64 xorshift64w", UNIF, 0, 0, GEN_XORSHIFT64W, drawUnif64Xorshift64w},
+    {"unifrnd64 kiss64w", UNIF, 0, 0, GEN_KISS64W, drawUnif64Kiss64w},
+    {"unifrnd32fill", UNIF, 0, 0, GEN_XORSHIFT, drawUnif32fill},
+    {"unifrnd64fill", UNIF, 0, 0, GEN_XORSHIFT, drawUnif64fill},
+    {"unifrnd32fill xorshift32vecfill", UNIF, 0, 0, GEN_VEC, drawUnif32vecfill},
+    {"unifrnd64 philox64", UNIF, 0, 0, GEN_PHILOX, drawUnif64Philox},
+    {"unifrnd32fill philox32fill", UNIF, 0, 0, GEN_PHILOX, drawUnif32philoxfill},
+    {"exprnd32 lambda=2", EXP, 2, 0, GEN_XORSHIFT, drawExp32},
+    {"exprnd64 lambda=2", EXP, 2, 0, GEN_XORSHIFT, drawExp64},
+    {"expzig32 lambda=2", EXP, 2, 0, GEN_XORSHIFT, drawExpZig32},
+    {"expzig64 lambda=2", EXP, 2, 0, GEN_XORSHIFT, drawExpZig64},
+    {"distrnd64 exp lambda=2", EXP, 2, 0, GEN_DIST, drawDist64},
+    {"normrnd32 5,2", NORM, 5, 2, GEN_XORSHIFT, drawNorm32},
+    {"normrnd64 5,2", NORM, 5, 2, GEN_XORSHIFT, drawNorm64},
+    {"normstdrnd32fill", NORM, 0, 1, GEN_XORSHIFT, drawNormstd32fill},
+    {"normstdrnd64fill", NORM, 0, 1, GEN_XORSHIFT, drawNormstd64fill},
+    {"normzig32 5,2", NORM, 5, 2, GEN_XORSHIFT, drawNormZig32},
+    {"normzig64 5,2", NORM, 5, 2, GEN_XORSHIFT, drawNormZig64},
+    {"distrnd32 normal 5,2", NORM, 5, 2, GEN_DIST, drawDist32},
+    {"distrnd64 normal 5,2", NORM, 5, 2, GEN_DIST, drawDist64},
+    {"gammarnd32 0.5,2", GAMMA, 0.5, 2, GEN_XORSHIFT, drawGamma32},
+    {"gammarnd64 0.5,2", GAMMA, 0.5, 2, GEN_XORSHIFT, drawGamma64},
+    {"gammarnd32 3,2", GAMMA, 3, 2, GEN_XORSHIFT, drawGamma32},
+    {"gammarnd64 3,2", GAMMA, 3, 2, GEN_XORSHIFT, drawGamma64},
+    {"gammarnd64 30,2", GAMMA, 30, 2, GEN_XORSHIFT, drawGamma64},
+    {"distrnd64 gamma 0.5,2", GAMMA, 0.5, 2, GEN_DIST, drawDist64},
+    {"distfill64 gamma 3,2", GAMMA, 3, 2, GEN_DIST, drawDist64fill},
+    {"rejfill32 gamma 0.5,2", GAMMA, 0.5, 2, GEN_DIST, drawRej32fill},
+    {"rejfill64 gamma 0.5,2", GAMMA, 0.5, 2, GEN_DIST, drawRej64fill},
+    {"rejfill32 gamma 3,2", GAMMA, 3, 2, GEN_DIST, drawRej32fill},
+    {"rejfill64 gamma 30,2", GAMMA, 30, 2, GEN_DIST, drawRej64fill},
+    {"betarnd32 2,5", BETA, 2, 5, GEN_XORSHIFT, drawBeta32},
+    {"betarnd64 2,5", BETA, 2, 5, GEN_XORSHIFT, drawBeta64},
+    {"betarnd64 0.5,0.5", BETA, 0.5, 0.5, GEN_XORSHIFT, drawBeta64},
+    {"distrnd64 beta 2,5", BETA, 2, 5, GEN_DIST, drawDist64},
+    {"distfill64 beta 0.5,0.5", BETA, 0.5, 0.5, GEN_DIST, drawDist64fill},
+    {"rejfill32 beta 2,5", BETA, 2, 5, GEN_DIST, drawRej32fill},
+    {"rejfill64 beta 0.5,0.5", BETA, 0.5, 0.5, GEN_DIST, drawRej64fill},
+    {"poissrnd32 lambda=5", POISS, 5, 0, GEN_XORSHIFT, drawPoiss32},
+    {"poissrnd64 lambda=5", POISS, 5, 0, GEN_XORSHIFT, drawPoiss64},
+    {"poissrnd32 lambda=50", POISS, 50, 0, GEN_XORSHIFT, drawPoiss32},
+    {"poissrnd64 lambda=50", POISS, 50, 0, GEN_XORSHIFT, drawPoiss64},
+    {"poissrnd32 lambda=500", POISS, 500, 0, GEN_XORSHIFT, drawPoiss32},
+    {"poissrnd64 lambda=500", POISS, 500, 0, GEN_XORSHIFT, drawPoiss64},
+    {"poissrnd64 lambda=100000", POISS, 100000, 0, GEN_XORSHIFT, drawPoiss64},
+    {"distrnd32 poisson lambda=50", POISS, 50, 0, GEN_DIST, drawDist32},
+    {"distfill32 poisson lambda=5", POISS, 5, 0, GEN_DIST, drawDist32fill},
+    {"distfill64 poisson lambda=500", POISS, 500, 0, GEN_DIST, drawDist64fill},
+    {"rejfill32 poisson lambda=50", POISS, 50, 0, GEN_DIST, drawRej32fill},
+    {"rejfill64 poisson lambda=500", POISS, 500, 0, GEN_DIST, drawRej64fill},
+    {"bernoullirnd64 p=0.3", BINO, 64, 0.3, GEN_XORSHIFT, drawBernoulli64},
+    {"bernoullifill32 p=0.01", BINO, 32, 0.01, GEN_XORSHIFT, drawBernoulli32fill},
+    {"bernoullifill32 p=0.7", BINO, 32, 0.7, GEN_XORSHIFT, drawBernoulli32fill},
+    {"binomialrnd32 5,0.3", BINO, 5, 0.3, GEN_XORSHIFT, drawBino32},
+    {"binomialrnd64 5,0.3", BINO, 5, 0.3, GEN_XORSHIFT, drawBino64},
+    {"binomialrnd32 9,0.7", BINO, 9, 0.7, GEN_XORSHIFT, drawBino32},
+    {"distrnd64 binomial 7,0.6", BINO, 7, 0.6, GEN_DIST, drawDist64},
+    {"binomialrnd32 100,0.1", BINO, 100, 0.1, GEN_XORSHIFT, drawBino32},
+    {"binomialrnd64 100,0.1", BINO, 100, 0.1, GEN_XORSHIFT, drawBino64},
+    {"binomialrnd32 100,0.7", BINO, 100, 0.7, GEN_XORSHIFT, drawBino32},
+    {"binomialrnd64 100,0.7", BINO, 100, 0.7, GEN_XORSHIFT, drawBino64},
+    {"binomialrnd32 100000,0.3", BINO, 100000, 0.3, GEN_XORSHIFT, drawBino32},
+    {"binomialrnd64 100000,0.3", BINO, 100000, 0.3, GEN_XORSHIFT, drawBino64},
+    {"distrnd32 binomial 100,0.1", BINO, 100, 0.1, GEN_DIST, drawDist32},
+    {"distfill64 binomial 100000,0.3", BINO, 100000, 0.3, GEN_DIST, drawDist64fill},
+    {"aliasrnd32 k=16", ALIAS, 16, 0, GEN_XORSHIFT, drawAlias32},
+    {"aliasfill32 k=1024", ALIAS, 1024, 0, GEN_XORSHIFT, drawAlias32fill},
+    {"boundedrnd32 n=37", INT, 37, 0, GEN_XORSHIFT, drawBounded32},
+    {"boundedrnd64 n=1000", INT, 1000, 0, GEN_XORSHIFT64W, drawBounded64},
+    {"boundedfill32 n=1000", INT, 1000, 0, GEN_XORSHIFT, drawBounded32fill},
+    {"boundedfill64 n=37", INT, 37, 0, GEN_XORSHIFT, drawBounded64fill},
+};
+
+#define NCASES (sizeof(cases) / sizeof(cases[0]))
+
+static uint32_t family2dist[] = {0, 0, TINYRNG_EXP, TINYRNG_NORMAL, TINYRNG_GAMMA, TINYRNG_BETA, TINYRNG_POISSON, TINYRNG_BINOMIAL, 0, 0};
+
+
+/*
+ * Accumulated statistics of one thread
+ */
+typedef struct {
+    const statcase *t;
+    uint64_t n;
+    uint64_t stream;
+    uint64_t master;
+    double mean;
+    int64_t kmin, kmax;
+    uint64_t *counts;     // KSBINS bins of F(x), or kmax - kmin + 3 values incl. under- and overflow
+    double s1, s2, s3, s4;
+    uint32_t err;
+} statthread;
+
+
+static void *threadRun(void *arg) {
+    statthread *s = (statthread *)arg;
+    const statcase *t = s->t;
+    drawctx *c;
+    rngstreams streams;
+    double x[BLOCK];
+    double d, d2, b1, b2, b3, b4;
+    uint64_t done;
+    uint32_t m, i;
+    int64_t k;
+
+    c = (drawctx *)calloc(1, sizeof(drawctx));
+    c->u2f = NAN;
+    c->u2d = NAN;
+    c->a = t->a;
+    c->b = t->b;
+
+    // one stream per thread
+    switch(t->generator) {
+        case GEN_KISS:
+            s->err |= streaminit(&streams, TINYRNG_KISS32, s->master);
+            s->err |= streamget(&streams, s->stream, c->seeds);
+            break;
+        case GEN_XORSHIFT64W:
+            s->err |= seedxorshift64wfrom(c->seeds, s->master + s->stream);
+            break;
+        case GEN_KISS64W:
+            s->err |= seedkiss64wfrom(c->seeds, s->master + s->stream);
+            break;
+        case GEN_VEC:
+            s->err |= seedxorshift32vecfrom(c->vec.seeds, s->master + s->stream);
+            break;
+        case GEN_PHILOX:
+            // one key per thread
+            s->err |= seedphilox(c->seeds, s->master + s->stream, 0);
+            break;
+        default:
+            s->err |= streaminit(&streams, TINYRNG_XORSHIFT32, s->master);
+            s->err |= streamget(&streams, s->stream, c->seeds);
+            break;
+    }
+    if(t->generator == GEN_DIST) {
+        s->err |= distinit(&c->dist, family2dist[t->family], t->a, t->b);
+    }
+    if(t->family == ALIAS) {
+        double *w = (double *)malloc((size_t)t->a * sizeof(double));
+
+        c->alias = (uint32_t *)malloc(2 * (size_t)t->a * sizeof(uint32_t));
+        for(i = 0; i < (uint32_t)t->a; i++) {
+            w[i] = aliasWeight(i);
+        }
+        s->err |= aliasinit(c->alias, w, (uint32_t)t->a);
+        free(w);
+    }
+
+    for(done = 0; s->err == TINYRNG_OK && done < s->n; done += m) {
+        m = (s->n - done) < BLOCK ? (uint32_t)(s->n - done) : BLOCK;
+        t->draw(c, x, m);
+
+        // moments about the analytic mean, block sums keep the rounding small
+        b1 = b2 = b3 = b4 = 0.0;
+        for(i = 0; i < m; i++) {
+            d = x[i] - s->mean;
+            d2 = d * d;
+            b1 += d;
+            b2 += d2;
+            b3 += d2 * d;
+            b4 += d2 * d2;
+        }
+        s->s1 += b1;
+        s->s2 += b2;
+        s->s3 += b3;
+        s->s4 += b4;
+
+        if(t->family >= POISS) {
+            for(i = 0; i < m; i++) {
+                k = (int64_t)llround(x[i]);
+                if(k < s->kmin || x[i] != (double)k) {
+                    s->counts[0]++;
+                } else if(k > s->kmax) {
+                    s->counts[s->kmax - s->kmin + 2]++;
+                } else {
+                    s->counts[k - s->kmin + 1]++;
+                }
+            }
+        } else {
+            for(i = 0; i < m; i++) {
+                d = cdf(t->family, t->a, t->b, x[i]) * KSBINS;
+                k = (int64_t)d;
+                k = k < 0 ? 0 : (k >= KSBINS ? KSBINS - 1 : k);
+                s->counts[k]++;
+            }
+        }
+    }
+
+    free(c->alias);
+    free(c);
+    return(NULL);
+}
+
+
+// p-value of the chi-square test on observed counts against expected counts
+static double chisquare(const uint64_t *obs, const double *expct, uint32_t l, double *chi2, uint32_t *df) {
+    double o = 0.0, e = 0.0, x = 0.0;
+    uint32_t i, classes = 0;
+
+    // pool neighbouring classes until each expects at least 5
+    for(i = 0; i < l; i++) {
+        o += obs[i];
+        e += expct[i];
+        if(e >= 5.0) {
+            x += (o - e) * (o - e) / e;
+            o = e = 0.0;
+            classes++;
+        }
+    }
+    if(e > 0.0 || o > 0.0) {
+        if(e == 0.0) {
+            x = INFINITY;
+        } else {
+            x += (o - e) * (o - e) / e;
+        }
+        classes++;
+    }
+    *chi2 = x;
+    *df = classes > 1 ? classes - 1 : 1;
+    return(isinf(x) ? 0.0 : incgamma(0.5 * *df, 0.5 * x, 1));
+}
+
+
+// runs one case, returns 1 on failure
+static uint32_t runCase(const statcase *t, uint64_t n, uint32_t nthreads, uint64_t master, double alpha) {
+    statthread *s = (statthread *)calloc(nthreads, sizeof(statthread));
+    pthread_t *ids = (pthread_t *)malloc(nthreads * sizeof(pthread_t));
+    uint64_t *counts, classes[CHIBINS];
+    double *expct;
+    double mean, var, s1 = 0, s2 = 0, s3 = 0, s4 = 0, m1, m2, m4, sd;
+    double ksd = 0.0, ksp = 1.0, chi2, chip, zmean, zvar, pmean, pvar, c, f, lo;
+    int64_t kmin = 0, kmax = 0, k;
+    uint32_t i, l, df, err = 0, failed;
+
+    moments(t->family, t->a, t->b, &mean, &var);
+    sd = sqrt(var);
+    if(t->family >= POISS) {
+        kmin = (int64_t)floor(mean - 12.0 * sd - 10.0);
+        kmin = kmin < 0 ? 0 : kmin;
+        kmax = (int64_t)ceil(mean + 12.0 * sd + 10.0);
+        if(t->family == BINO && kmax > (int64_t)t->a) {
+            kmax = (int64_t)t->a;
+        }
+        if(t->family == ALIAS || t->family == INT) {
+            kmax = (int64_t)t->a - 1;
+        }
+        l = (uint32_t)(kmax - kmin + 3);
+    } else {
+        l = KSBINS;
+    }
+
+    for(i = 0; i < nthreads; i++) {
+        s[i].t = t;
+        s[i].n = n / nthreads + (i < n % nthreads ? 1 : 0);
+        s[i].stream = i;
+        s[i].master = master;
+        s[i].mean = mean;
+        s[i].kmin = kmin;
+        s[i].kmax = kmax;
+        s[i].counts = (uint64_t *)calloc(l, sizeof(uint64_t));
+        pthread_create(&ids[i], NULL, threadRun, &s[i]);
+    }
+
+    // merge
+    counts = (uint64_t *)calloc(l, sizeof(uint64_t));
+    for(i = 0; i < nthreads; i++) {
+        pthread_join(ids[i], NULL);
+        err |= s[i].err;
+        s1 += s[i].s1;
+        s2 += s[i].s2;
+        s3 += s[i].s3;
+        s4 += s[i].s4;
+        for(k = 0; k < l; k++) {
+            counts[k] += s[i].counts[k];
+        }
+        free(s[i].counts);
+    }
+    if(err != TINYRNG_OK) {
+        printf("%-34s error %u\n", t->name, err);
+        free(counts);
+        free(ids);
+        free(s);
+        return(1);
+    }
+
+    // moments, m1 is the deviation of the sample mean from the analytic mean
+    m1 = s1 / n;
+    m2 = s2 / n - m1 * m1;
+    m4 = s4 / n - 4.0 * m1 * s3 / n + 6.0 * m1 * m1 * s2 / n - 3.0 * m1 * m1 * m1 * m1;
+    zmean = m1 / sqrt(var / n);
+    zvar = (m2 - var) / sqrt(fmax(m4 - m2 * m2, 1e-300) / n);
+    pmean = erfc(fabs(zmean) / M_SQRT2);
+    pvar = erfc(fabs(zvar) / M_SQRT2);
+
+    expct = (double *)malloc(l * sizeof(double));
+    if(t->family >= POISS) {
+        // pmf classes, under- and overflow take the remaining mass
+        lo = 0.0;
+        for(k = kmin; k <= kmax; k++) {
+            expct[k - kmin + 1] = n * pmf(t->family, t->a, t->b, k);
+            lo += expct[k - kmin + 1];
+        }
+        expct[0] = 0.0;
+        for(k = 0; k < kmin; k++) {
+            expct[0] += n * pmf(t->family, t->a, t->b, k);
+        }
+        expct[l - 1] = fmax(n - lo - expct[0], 0.0);
+        chip = chisquare(counts, expct, l, &chi2, &df);
+    } else {
+        // KS distance at the bin edges
+        c = 0.0;
+        for(i = 0; i < KSBINS; i++) {
+            c += counts[i];
+            f = fabs(c / n - (i + 1.0) / KSBINS);
+            ksd = f > ksd ? f : ksd;
+        }
+        ksp = kolmogorov((sqrt((double)n) + 0.12 + 0.11 / sqrt((double)n)) * ksd);
+
+        // equiprobable classes of KSBINS / CHIBINS bins
+        for(i = 0; i < CHIBINS; i++) {
+            expct[i] = (double)n / CHIBINS;
+            classes[i] = 0;
+            for(k = 0; k < KSBINS / CHIBINS; k++) {
+                classes[i] += counts[i * (KSBINS / CHIBINS) + k];
+            }
+        }
+        chip = chisquare(classes, expct, CHIBINS, &chi2, &df);
+    }
+
+    // written so that a NaN p-value fails
+    failed = !(ksp >= alpha) || !(chip >= alpha) || !(pmean >= alpha) || !(pvar >= alpha);
+    if(t->family >= POISS) {
+        printf("%-34s %10s %9s %12.1f %5u %9.2e %7.2f %7.2f  %s\n", t->name, "-", "-", chi2, df, chip, zmean, zvar, failed ? "FAIL" : "ok");
+    } else {
+        printf("%-34s %10.3e %9.2e %12.1f %5u %9.2e %7.2f %7.2f  %s\n", t->name, ksd, ksp, chi2, df, chip, zmean, zvar, failed ? "FAIL" : "ok");
+    }
+    fflush(stdout);
+
+    free(expct);
+    free(counts);
+    free(ids);
+    free(s);
+    return(failed);
+}
+
+
+/*
+ * Checks, each prints one line and returns 1 on failure
+ */
+typedef struct statcheck statcheck;
+
+struct statcheck {
+    const char *name;
+    uint32_t method;
+    uint32_t k, n;
+    uint32_t (*run)(const statcheck *t, uint64_t n, uint64_t master, uint32_t nthreads, double alpha);
+};
+
+// sampling methods
+#define SAMPLE_FLOYD32 0
+#define SAMPLE_FLOYD64 1
+#define SAMPLE_SELECT 2
+
+// draws of the sampling checks, at most 10^7
+#define SAMPLE_DRAWS(n) ((n) < 10000000ULL ? (n) : 10000000ULL)
+
+
+static uint32_t checkLine(const statcheck *t, double chi2, uint32_t df, double p, uint32_t failed) {
+    printf("%-34s %10s %9s %12.1f %5u %9.2e %7s %7s  %s\n", t->name, "-", "-", chi2, df, p, "-", "-", failed ? "FAIL" : "ok");
+    fflush(stdout);
+    return(failed);
+}
+
+
+// parfill of 3.5 blocks on one and on nthreads threads, bit-identical
+static uint32_t checkParfill(const statcheck *t, uint64_t samples, uint64_t master, uint32_t nthreads, double alpha) {
+    const uint64_t n = 7 * TINYRNG_PAR_BLOCK / 2;
+    rngstreams streams;
+    rngdist dist;
+    float *f1 = (float *)malloc(n * sizeof(float)), *fn = (float *)malloc(n * sizeof(float));
+    double *d1 = (double *)malloc(n * sizeof(double)), *dn = (double *)malloc(n * sizeof(double));
+    uint32_t err = 0, differ = 0;
+
+    if(nthreads < 2) {
+        nthreads = 4;
+    }
+
+    err |= distinit(&dist, TINYRNG_GAMMA, 5.0, 1.0);
+    err |= streaminit(&streams, TINYRNG_XORSHIFT32, master);
+    err |= parfill32(&streams, 3, &dist, f1, n, 1);
+    err |= parfill32(&streams, 3, &dist, fn, n, nthreads);
+    differ |= memcmp(f1, fn, n * sizeof(float));
+    err |= parfill64(&streams, 3, &dist, d1, n, 1);
+    err |= parfill64(&streams, 3, &dist, dn, n, nthreads);
+    differ |= memcmp(d1, dn, n * sizeof(double));
+    err |= parfill64(&streams, 4, NULL, d1, n, 1);
+    err |= parfill64(&streams, 4, NULL, dn, n, nthreads);
+    differ |= memcmp(d1, dn, n * sizeof(double));
+
+    // KISS32 streams, uniform only
+    err |= streaminit(&streams, TINYRNG_KISS32, master);
+    err |= parfill32(&streams, 3, NULL, f1, n, 1);
+    err |= parfill32(&streams, 3, NULL, fn, n, nthreads);
+    differ |= memcmp(f1, fn, n * sizeof(float));
+    differ |= parfill64(&streams, 3, &dist, dn, n, nthreads) != TINYRNG_INTERVAL_ERROR;
+
+    printf("%-34s %u threads, %s\n", t->name, nthreads, (err || differ) ? "FAIL" : "ok");
+
+    free(f1);
+    free(fn);
+    free(d1);
+    free(dn);
+    return(err || differ);
+}
+
+
+// one k-subset of [0, n), n <= 64, as a bit mask, 0 if values repeat,
+// are out of range or, for selectfill64, do not ascend
+static uint64_t sampleMask(uint32_t method, uint32_t *seeds, uint32_t k, uint32_t n, uint32_t *err) {
+    uint32_t s32[64];
+    uint64_t s64[64], mask = 0, bit;
+    rngselect sel;
+    uint32_t i;
+
+    switch(method) {
+        case SAMPLE_FLOYD32:
+            *err |= samplefloyd32(xorshift32, seeds, s32, k, n);
+            for(i = 0; i < k; i++) {
+                s64[i] = s32[i];
+            }
+            break;
+        case SAMPLE_FLOYD64:
+            *err |= samplefloyd64(xorshift64, seeds, s64, k, n);
+            break;
+        default:
+            *err |= selectinit(&sel, k, n);
+            *err |= selectfill64(xorshift64, seeds, &sel, s64, k);
+            for(i = 1; i < k; i++) {
+                if(s64[i] <= s64[i - 1]) return(0);
+            }
+    }
+
+    for(i = 0; i < k; i++) {
+        if(s64[i] >= n) return(0);
+        bit = 1ULL << s64[i];
+        if(mask & bit) return(0);
+        mask |= bit;
+    }
+    return(mask);
+}
+
+
+// chi-square over all k-subsets of [0, n), n <= 16
+static uint32_t checkSubsets(const statcheck *t, uint64_t samples, uint64_t master, uint32_t nthreads, double alpha) {
+    uint64_t draws = SAMPLE_DRAWS(samples), d, mask;
+    uint32_t *rank = (uint32_t *)malloc(((size_t)1 << t->n) * sizeof(uint32_t));
+    uint64_t *obs;
+    double *expct;
+    double chi2 = 0.0, p = 0.0;
+    uint32_t seeds[5], classes = 0, i, df = 0, err = 0, bad = 0;
+
+    // rank of each mask with k bits
+    for(i = 0; i < (1U << t->n); i++) {
+        rank[i] = __builtin_popcount(i) == (int)t->k ? classes++ : 0;
+    }
+    obs = (uint64_t *)calloc(classes, sizeof(uint64_t));
+    expct = (double *)malloc(classes * sizeof(double));
+    for(i = 0; i < classes; i++) {
+        expct[i] = (double)draws / classes;
+    }
+
+    err |= seedfrom(seeds, 5, master);
+    for(d = 0; d < draws; d++) {
+        mask = sampleMask(t->method, seeds, t->k, t->n, &err);
+        bad += (mask == 0);
+        obs[rank[mask]]++;
+    }
+    p = chisquare(obs, expct, classes, &chi2, &df);
+
+    free(rank);
+    free(obs);
+    free(expct);
+    return(checkLine(t, chi2, df, p, err || bad || !(p >= alpha)));
+}
+
+
+/*
+ * Inclusion counts of the values of [0, n), n <= 64. With p = k / n,
+ * a count has variance p (1 - p) per draw and two counts the covariance
+ * -p (1 - p) / (n - 1), so sum (o - e)^2 / e is (1 - p) n / (n - 1)
+ * times a chi-square with n - 1 degrees of freedom.
+ */
+static uint32_t checkInclusion(const statcheck *t, uint64_t samples, uint64_t master, uint32_t nthreads, double alpha) {
+    uint64_t draws = SAMPLE_DRAWS(samples), d, mask, obs[64] = {0};
+    double e = (double)draws * t->k / t->n, p = (double)t->k / t->n, chi2 = 0.0, pv = 0.0;
+    uint32_t seeds[5], i, err = 0, bad = 0;
+
+    err |= seedfrom(seeds, 5, master);
+    for(d = 0; d < draws; d++) {
+        mask = sampleMask(t->method, seeds, t->k, t->n, &err);
+        bad += (mask == 0);
+        for(i = 0; i < t->n; i++) {
+            obs[i] += (mask >> i) & 1;
+        }
+    }
+
+    for(i = 0; i < t->n; i++) {
+        chi2 += (obs[i] - e) * (obs[i] - e) / e;
+    }
+    chi2 *= (t->n - 1.0) / (t->n * (1.0 - p));
+    pv = incgamma(0.5 * (t->n - 1), 0.5 * chi2, 1);
+
+    return(checkLine(t, chi2, t->n - 1, pv, err || bad || !(pv >= alpha)));
+}
+
+
+// argument checks and the end of the selection
+static uint32_t checkSampleErrors(const statcheck *t, uint64_t samples, uint64_t master, uint32_t nthreads, double alpha) {
+    uint32_t seeds[5], s32[4] = {7, 7, 7, 7};
+    uint64_t s64[4] = {7, 7, 7, 7}, index = 7;
+    rngselect sel;
+    uint32_t failed = 0;
+
+    seedfrom(seeds, 5, master);
+
+    failed |= samplefloyd32(xorshift32, seeds, s32, 4, 3) != TINYRNG_INTERVAL_ERROR;
+    failed |= samplefloyd64(xorshift64, seeds, s64, 4, 3) != TINYRNG_INTERVAL_ERROR;
+    failed |= samplefloyd32(xorshift32, seeds, s32, 0, 3) != TINYRNG_OK || s32[0] != 7;
+    failed |= samplefloyd64(xorshift64, seeds, s64, 0, 0) != TINYRNG_OK || s64[0] != 7;
+    failed |= boundedrnd32(xorshift32, seeds, s32, 0) != TINYRNG_INTERVAL_ERROR;
+    failed |= boundedrnd64(xorshift64, seeds, s64, 0) != TINYRNG_INTERVAL_ERROR;
+
+    failed |= selectinit(&sel, 4, 3) != TINYRNG_INTERVAL_ERROR;
+    failed |= selectinit(&sel, 1, (1ULL << 53) + 1) != TINYRNG_INTERVAL_ERROR;
+
+    // k = 0 selects nothing
+    failed |= selectinit(&sel, 0, 10) != TINYRNG_OK;
+    failed |= selectnext64(xorshift64, seeds, &sel, &index) != TINYRNG_INTERVAL_ERROR || index != 7;
+
+    // 3 of 3 are 0, 1, 2, a fourth call and too large a fill fail
+    failed |= selectinit(&sel, 3, 3) != TINYRNG_OK;
+    failed |= selectfill64(xorshift64, seeds, &sel, s64, 4) != TINYRNG_INTERVAL_ERROR;
+    failed |= selectfill64(xorshift64, seeds, &sel, s64, 3) != TINYRNG_OK;
+    failed |= s64[0] != 0 || s64[1] != 1 || s64[2] != 2;
+    failed |= selectnext64(xorshift64, seeds, &sel, &index) != TINYRNG_INTERVAL_ERROR || index != 7;
+
+    printf("%-34s %s\n", t->name, failed ? "FAIL" : "ok");
+    return(failed);
+}
+
+
+static const statcheck checks[] = {
+    {"parfill 1 vs n threads", 0, 0, 0, checkParfill},
+    {"samplefloyd32 subsets 3 of 6", SAMPLE_FLOYD32, 3, 6, checkSubsets},
+    {"samplefloyd64 subsets 3 of 6", SAMPLE_FLOYD64, 3, 6, checkSubsets},
+    {"selectfill64 subsets 3 of 6", SAMPLE_SELECT, 3, 6, checkSubsets},
+    {"selectfill64 subsets 2 of 14", SAMPLE_SELECT, 2, 14, checkSubsets},
+    {"samplefloyd32 inclusion 5 of 20", SAMPLE_FLOYD32, 5, 20, checkInclusion},
+    {"samplefloyd64 inclusion 40 of 64", SAMPLE_FLOYD64, 40, 64, checkInclusion},
+    {"selectfill64 inclusion 4 of 60", SAMPLE_SELECT, 4, 60, checkInclusion},
+    {"selectfill64 inclusion 20 of 60", SAMPLE_SELECT, 20, 60, checkInclusion},
+    {"sampling argument errors", 0, 0, 0, checkSampleErrors},
+};
+
+#define NCHECKS (sizeof(checks) / sizeof(checks[0]))
+
+
+int main(int argc, char **argv) {
+    const char *pattern = NULL;
+    uint64_t n = NSAMPLES;
+    uint64_t master = 20130101;
+    uint32_t nthreads = (uint32_t)sysconf(_SC_NPROCESSORS_ONLN);
+    double alpha = ALPHA;
+    uint32_t i, failed = 0, ran = 0;
+    int opt;
+
+    while((opt = getopt(argc, argv, "n:t:a:s:")) != -1) {
+        switch(opt) {
+            case 'n': n = (uint64_t)strtod(optarg, NULL); break;
+            case 't': nthreads = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'a': alpha = strtod(optarg, NULL); break;
+            case 's': master = strtoull(optarg, NULL, 10); break;
+            default:
+                fprintf(stderr, "usage: %s [-n samples] [-t threads] [-a alpha] [-s seed] [pattern]\n", argv[0]);
+                return(255);
+        }
+    }
+    if(optind < argc) {
+        pattern = argv[optind];
+    }
+    if(n < 1000 || nthreads == 0) {
+        fprintf(stderr, "at least 1000 samples and one thread\n");
+        return(255);
+    }
+
+    printf("%llu samples per case, %u threads, alpha %g, seed %llu\n\n", (unsigned long long)n, nthreads, alpha, (unsigned long long)master);
+    printf("%-34s %10s %9s %12s %5s %9s %7s %7s\n", "case", "KS D", "KS p", "chi2", "df", "chi2 p", "z mean", "z var");
+    for(i = 0; i < NCASES; i++) {
+        if(pattern != NULL && strstr(cases[i].name, pattern) == NULL) {
+            continue;
+        }
+        failed += runCase(&cases[i], n, nthreads, master, alpha);
+        ran++;
+    }
+    printf("\n");
+    for(i = 0; i < NCHECKS; i++) {
+        if(pattern != NULL && strstr(checks[i].name, pattern) == NULL) {
+            continue;
+        }
+        failed += checks[i].run(&checks[i], n, master, nthreads, alpha);
+        ran++;
+    }
+    printf("\n%u of %u cases and checks failed\n", failed, ran);
+    return(failed > 255 ? 255 : (int)failed);
+}
@@ -8,6 +8,13 @@
 
 int main() {
     uint32_t *seeds;
+    uint32_t *philox;
+    rngdist dist;
+    xorshift32vecstate vec;
+    float *buffer;
+    uint32_t *ibuffer;
+    uint32_t alias[8];
+    double weights[4] = {1.0, 2.0, 3.0, 4.0};
     uint32_t err = 0;
     uint32_t i = 0;
     float fsample = 0.0f;
@@ -32,6 +39,42 @@ int main() {
     }
     fclose(file);
 
+    /*
+     * multi-lane 32-bit XORSHIFT engine
+     */
+
+    // seed all lanes
+    err = seedxorshift32vec(vec.seeds);
+
+    // uniform (0, 1], generated in one bulk call
+    buffer = (float*)malloc(NSAMPLES * sizeof(float));
+    err = unifrnd32fill(xorshift32vecfill, vec.seeds, buffer, NSAMPLES);
+
+    file = fopen("testdata/unif01_xorshift32vec.txt", "w");
+    for(i = 0; i < NSAMPLES; i ++) {
+        fprintf(file, "%f\n", buffer[i]);
+    }
+    fclose(file);
+    free(buffer);
+
+    /*
+     * counter-based Philox4x32-10 generator
+     */
+    philox = (uint32_t*)malloc(TINYRNG_PHILOX_WORDS * sizeof(uint32_t));
+    err = seedphilox(philox, ((uint64_t)seeds[0] << 32) | seeds[1], 0);
+
+    // uniform (0, 1], generated in one bulk call
+    buffer = (float*)malloc(NSAMPLES * sizeof(float));
+    err = unifrnd32fill(philox32fill, philox, buffer, NSAMPLES);
+
+    file = fopen("testdata/unif01_philox32.txt", "w");
+    for(i = 0; i < NSAMPLES; i ++) {
+        fprintf(file, "%f\n", buffer[i]);
+    }
+    fclose(file);
+    free(buffer);
+    free(philox);
+
     /*
      * 32-bit KISS generator
      */
@@ -59,6 +102,14 @@ int main() {
     }
     fclose(file);
 
+    // exponential by the Ziggurat method, lambda = 1
+    file = fopen("testdata/expzig1_32.txt", "w");
+    for(i = 0; i < NSAMPLES; i ++) {
+        err = expzig32(kiss32, seeds, &fsample, 1.0f);
+        fprintf(file, "%f\n", fsample);
+    }
+    fclose(file);
+
     // standard normal, mu = 0, sigma = 1
     file = fopen("testdata/normstd_32.txt", "w");
     for(i = 0; i < NSAMPLES; i ++) {
@@ -75,12 +126,55 @@ int main() {
     }
     fclose(file);
 
+    // standard normal by the Ziggurat method
+    file = fopen("testdata/normstdzig_32.txt", "w");
+    for(i = 0; i < NSAMPLES; i ++) {
+        err = normstdzig32(kiss32, seeds, &fsample);
+        fprintf(file, "%f\n", fsample);
+    }
+    fclose(file);
+
+    // normal by the Ziggurat method, mu = 5, sigma = 5
+    file = fopen("testdata/normzig55_32.txt", "w");
+    for(i = 0; i < NSAMPLES; i ++) {
+        err = normzig32(kiss32, seeds, &fsample, 5.0f, 5.0f);
+        fprintf(file, "%f\n", fsample);
+    }
+    fclose(file);
+
+    // standard normal by the batched Box-Muller transform
+    buffer = (float*)malloc(NSAMPLES * sizeof(float));
+    err = normstdrnd32fill(kiss32fill, seeds, buffer, NSAMPLES);
+
+    file = fopen("testdata/normstdfill_32.txt", "w");
+    for(i = 0; i < NSAMPLES; i ++) {
+        fprintf(file, "%f\n", buffer[i]);
+    }
+    fclose(file);
+    free(buffer);
+
     // binomial
     file = fopen("testdata/bino2005_32.txt", "w");
     for(i = 0; i < NSAMPLES; i ++) {
         err = binomialrnd32(kiss32, seeds, &isample, &u2, 20, 0.5);
         fprintf(file, "%d\n", isample);
     }
+    fclose(file);
+
+    // binomial, n < 10, Bernoulli bits
+    file = fopen("testdata/bino903_32.txt", "w");
+    for(i = 0; i < NSAMPLES; i ++) {
+        err = binomialrnd32(kiss32, seeds, &isample, &u2, 9, 0.3);
+        fprintf(file, "%d\n", isample);
+    }
+    fclose(file);
+
+    // binomial, BTPE
+    file = fopen("testdata/bino100003_32.txt", "w");
+    for(i = 0; i < NSAMPLES; i ++) {
+        err = binomialrnd32(kiss32, seeds, &isample, &u2, 1000, 0.3);
+        fprintf(file, "%d\n", isample);
+    }
     fclose(file);     
 
     // Poisson, lambda = 5
@@ -91,6 +185,14 @@ int main() {
     }
     fclose(file);
 
+    // Poisson, lambda = 100, PTRS
+    file = fopen("testdata/poiss100_32.txt", "w");
+    for(i = 0; i < NSAMPLES; i ++) {
+        err = poissrnd32(kiss32, seeds, &fsample, &u2, 100.0f);
+        fprintf(file, "%f\n", fsample);
+    }
+    fclose(file);
+
     // gamma
     file = fopen("testdata/gamm51_32.txt", "w");
     for(i = 0; i < NSAMPLES; i ++) {
@@ -107,6 +209,39 @@ int main() {
     }
     fclose(file);
 
+    // beta, alpha = 2, beta = 5, prepared once
+    err = distinit(&dist, TINYRNG_BETA, 2.0, 5.0);
+    buffer = (float*)malloc(NSAMPLES * sizeof(float));
+    err = distfill32(kiss32, seeds, &dist, buffer, NSAMPLES);
+
+    file = fopen("testdata/beta25dist_32.txt", "w");
+    for(i = 0; i < NSAMPLES; i ++) {
+        fprintf(file, "%f\n", buffer[i]);
+    }
+    fclose(file);
+    free(buffer);
+
+    // discrete, weights 1, 2, 3, 4 by the alias method
+    err = aliasinit(alias, weights, 4);
+    ibuffer = (uint32_t*)malloc(NSAMPLES * sizeof(uint32_t));
+    err = aliasfill32(kiss32fill, seeds, alias, 4, ibuffer, NSAMPLES);
+
+    file = fopen("testdata/alias1234_32.txt", "w");
+    for(i = 0; i < NSAMPLES; i ++) {
+        fprintf(file, "%u\n", ibuffer[i]);
+    }
+    fclose(file);
+
+    // uniform integers on [0, 1000)
+    err = boundedfill32(kiss32fill, seeds, ibuffer, NSAMPLES, 1000);
+
+    file = fopen("testdata/int1000_32.txt", "w");
+    for(i = 0; i < NSAMPLES; i ++) {
+        fprintf(file, "%u\n", ibuffer[i]);
+    }
+    fclose(file);
+    free(ibuffer);
+
     free(seeds);
     
     return(0);
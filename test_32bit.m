@@ -4,6 +4,22 @@ fid = fopen('testdata/unif01_xorshift32.txt', 'r');
 data = fscanf(fid, '%f');
 fclose(fid);
 
+[h, p, k] = kstest2(data, unifrnd(0, 1, length(data), 1))
+
+disp('Uniform, multi-lane 32-bit XORSHIFT');
+fid = fopen('testdata/unif01_xorshift32vec.txt', 'r');
+data = fscanf(fid, '%f');
+fclose(fid);
+
+[h, p, k] = kstest2(data, unifrnd(0, 1, length(data), 1))
+
+disp('Uniform, Philox4x32-10');
+fid = fopen('testdata/unif01_philox32.txt', 'r');
+data = fscanf(fid, '%f');
+fclose(fid);
+
+[h, p, k] = kstest2(data, unifrnd(0, 1, length(data), 1))
+
 disp('Uniform, 32-bit KISS');
 fid = fopen('testdata/unif01_kiss32.txt', 'r');
 data = fscanf(fid, '%f');
@@ -19,6 +35,13 @@ fclose(fid);
 
 [h, p, k] = kstest2(data, exprnd(1, length(data), 1))
 
+disp('Exponential, Ziggurat');
+fid = fopen('testdata/expzig1_32.txt', 'r');
+data = fscanf(fid, '%f');
+fclose(fid);
+
+[h, p, k] = kstest2(data, exprnd(1, length(data), 1))
+
 disp('Standard normal')
 fid = fopen('testdata/normstd_32.txt', 'r');
 data = fscanf(fid, '%f');
@@ -33,6 +56,41 @@ fclose(fid);
 
 [h, p, k] = kstest2(data, normrnd(5, 5, length(data), 1))
 
+disp('Standard normal, Ziggurat')
+fid = fopen('testdata/normstdzig_32.txt', 'r');
+data = fscanf(fid, '%f');
+fclose(fid);
+
+[h, p, k] = kstest2(data, normrnd(0, 1, length(data), 1))
+
+disp('Normal, Ziggurat');
+fid = fopen('testdata/normzig55_32.txt', 'r');
+data = fscanf(fid, '%f');
+fclose(fid);
+
+[h, p, k] = kstest2(data, normrnd(5, 5, length(data), 1))
+
+disp('Standard normal, batched Box-Muller')
+fid = fopen('testdata/normstdfill_32.txt', 'r');
+data = fscanf(fid, '%f');
+fclose(fid);
+
+[h, p, k] = kstest2(data, normrnd(0, 1, length(data), 1))
+
+disp('binomial, Bernoulli bits');
+fid = fopen('testdata/bino903_32.txt', 'r');
+data = fscanf(fid, '%d');
+fclose(fid);
+
+[h, p, k] = kstest2(data, binornd(9, 0.3, length(data), 1))
+
+disp('binomial, BTPE');
+fid = fopen('testdata/bino100003_32.txt', 'r');
+data = fscanf(fid, '%d');
+fclose(fid);
+
+[h, p, k] = kstest2(data, binornd(1000, 0.3, length(data), 1))
+
 disp('Poisson');
 fid = fopen('testdata/poiss5_32.txt', 'r');
 data = fscanf(fid, '%f');
@@ -40,6 +98,13 @@ fclose(fid);
 
 [h, p, k] = kstest2(data, poissrnd(5,  length(data), 1))
 
+disp('Poisson, PTRS');
+fid = fopen('testdata/poiss100_32.txt', 'r');
+data = fscanf(fid, '%f');
+fclose(fid);
+
+[h, p, k] = kstest2(data, poissrnd(100,  length(data), 1))
+
 disp('Gamma');
 fid = fopen('testdata/gamm51_32.txt', 'r');
 data = fscanf(fid, '%f');
@@ -52,3 +117,24 @@ data = fscanf(fid, '%f');
 fclose(fid);
 
 [h, p, k] = kstest2(data, betarnd(2, 5,  length(data), 1))
+
+disp('Beta, prepared distribution')
+fid = fopen('testdata/beta25dist_32.txt', 'r');
+data = fscanf(fid, '%f');
+fclose(fid);
+
+[h, p, k] = kstest2(data, betarnd(2, 5,  length(data), 1))
+
+disp('Discrete, alias method')
+fid = fopen('testdata/alias1234_32.txt', 'r');
+data = fscanf(fid, '%d');
+fclose(fid);
+
+[h, p, k] = kstest2(data, randsample(0:3, length(data), true, [1 2 3 4])')
+
+disp('Uniform integers on [0, 1000)')
+fid = fopen('testdata/int1000_32.txt', 'r');
+data = fscanf(fid, '%d');
+fclose(fid);
+
+[h, p, k] = kstest2(data, randi([0 999], length(data), 1))
@@ -3,6 +3,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <inttypes.h>
 #include <math.h>
 #include "TinyRNG.h"
 
@@ -10,10 +11,14 @@
 
 int main() {
     uint32_t *seeds;
+    rngdist dist;
+    rngstreams streams;
+    double *buffer;
     uint32_t err = 0;
     uint32_t i = 0;
     double fsample = 0.0f;
     int64_t isample = 0;
+    uint64_t usample = 0;
     double u2 = 0.0f;
     
     FILE *file;
@@ -23,7 +28,7 @@ int main() {
      */
 
     // seed the RNG
-    seeds = (uint32_t*)malloc(5 * sizeof(uint32_t));
+    seeds = (uint32_t*)malloc(8 * sizeof(uint32_t));
     err = seed(seeds, 5);
     
     // uniform (0, 1]
@@ -49,6 +54,39 @@ int main() {
     }
     fclose(file);
 
+    /*
+     * native 64-bit XORSHIFT generator
+     */
+
+    // seed the RNG
+    err = seedxorshift64w(seeds);
+
+    // uniform (0, 1]
+    file = fopen("testdata/unif01_xorshift64w.txt", "w");
+    for(i = 0; i < NSAMPLES; i ++) {
+        err = unifrnd64(xorshift64w, seeds, &fsample);
+        fprintf(file, "%f\n", fsample);
+    }
+    fclose(file);
+
+    /*
+     * native 64-bit KISS generator
+     */
+
+    // seed the RNG
+    err = seedkiss64w(seeds);
+
+    // uniform (0, 1]
+    file = fopen("testdata/unif01_kiss64w.txt", "w");
+    for(i = 0; i < NSAMPLES; i ++) {
+        err = unifrnd64(kiss64w, seeds, &fsample);
+        fprintf(file, "%f\n", fsample);
+    }
+    fclose(file);
+
+    // the transformations below use the KISS generator
+    err = seedkiss(seeds);
+
     /*
      * test the transformations
      */
@@ -61,6 +99,14 @@ int main() {
     }
     fclose(file);
 
+    // exponential by the Ziggurat method, lambda = 1
+    file = fopen("testdata/expzig1_64.txt", "w");
+    for(i = 0; i < NSAMPLES; i ++) {
+        err = expzig64(kiss64, seeds, &fsample, 1.0);
+        fprintf(file, "%f\n", fsample);
+    }
+    fclose(file);
+
     // standard normal, mu = 0, sigma = 1
     file = fopen("testdata/normstd_64.txt", "w");
     for(i = 0; i < NSAMPLES; i ++) {
@@ -77,12 +123,55 @@ int main() {
     }
     fclose(file);
 
+    // standard normal by the Ziggurat method
+    file = fopen("testdata/normstdzig_64.txt", "w");
+    for(i = 0; i < NSAMPLES; i ++) {
+        err = normstdzig64(kiss64, seeds, &fsample);
+        fprintf(file, "%f\n", fsample);
+    }
+    fclose(file);
+
+    // normal by the Ziggurat method, mu = 5, sigma = 5
+    file = fopen("testdata/normzig55_64.txt", "w");
+    for(i = 0; i < NSAMPLES; i ++) {
+        err = normzig64(kiss64, seeds, &fsample, 5.0, 5.0);
+        fprintf(file, "%f\n", fsample);
+    }
+    fclose(file);
+
+    // standard normal by the batched Box-Muller transform
+    buffer = (double*)malloc(NSAMPLES * sizeof(double));
+    err = normstdrnd64fill(kiss64fill, seeds, buffer, NSAMPLES);
+
+    file = fopen("testdata/normstdfill_64.txt", "w");
+    for(i = 0; i < NSAMPLES; i ++) {
+        fprintf(file, "%f\n", buffer[i]);
+    }
+    fclose(file);
+    free(buffer);
+
     // binomial
     file = fopen("testdata/bino2005_64.txt", "w");
     for(i = 0; i < NSAMPLES; i ++) {
         err = binomialrnd64(kiss64, seeds, &isample, &u2, 20, 0.5);
         fprintf(file, "%d\n", isample);
     }
+    fclose(file);
+
+    // binomial, n < 10, Bernoulli bits
+    file = fopen("testdata/bino903_64.txt", "w");
+    for(i = 0; i < NSAMPLES; i ++) {
+        err = binomialrnd64(kiss64, seeds, &isample, &u2, 9, 0.3);
+        fprintf(file, "%" PRId64 "\n", isample);
+    }
+    fclose(file);
+
+    // binomial, BTPE
+    file = fopen("testdata/bino100003_64.txt", "w");
+    for(i = 0; i < NSAMPLES; i ++) {
+        err = binomialrnd64(kiss64, seeds, &isample, &u2, 1000, 0.3);
+        fprintf(file, "%" PRId64 "\n", isample);
+    }
     fclose(file);    
 
     // Poisson, lambda = 5
@@ -93,6 +182,14 @@ int main() {
     }
     fclose(file);
 
+    // Poisson, lambda = 100, PTRS
+    file = fopen("testdata/poiss100_64.txt", "w");
+    for(i = 0; i < NSAMPLES; i ++) {
+        err = poissrnd64(kiss64, seeds, &fsample, &u2, 100.0);
+        fprintf(file, "%f\n", fsample);
+    }
+    fclose(file);
+
     // gamma
     file = fopen("testdata/gamm51_64.txt", "w");
     for(i = 0; i < NSAMPLES; i ++) {
@@ -108,6 +205,38 @@ int main() {
         fprintf(file, "%f\n", fsample);
     }
     fclose(file);
+
+    // beta, alpha = 2, beta = 5, prepared once
+    err = distinit(&dist, TINYRNG_BETA, 2.0, 5.0);
+    buffer = (double*)malloc(NSAMPLES * sizeof(double));
+    err = distfill64(kiss64, seeds, &dist, buffer, NSAMPLES);
+
+    file = fopen("testdata/beta25dist_64.txt", "w");
+    for(i = 0; i < NSAMPLES; i ++) {
+        fprintf(file, "%f\n", buffer[i]);
+    }
+    fclose(file);
+
+    // gamma, parallel fill on 4 threads
+    err = getSeeds(seeds, 2);
+    err = streaminit(&streams, TINYRNG_XORSHIFT32, ((uint64_t)seeds[0] << 32) | seeds[1]);
+    err = distinit(&dist, TINYRNG_GAMMA, 5.0, 1.0);
+    err = parfill64(&streams, 0, &dist, buffer, NSAMPLES, 4);
+
+    file = fopen("testdata/gamm51par_64.txt", "w");
+    for(i = 0; i < NSAMPLES; i ++) {
+        fprintf(file, "%f\n", buffer[i]);
+    }
+    fclose(file);
+    free(buffer);
+
+    // uniform integers on [0, 1000)
+    file = fopen("testdata/int1000_64.txt", "w");
+    for(i = 0; i < NSAMPLES; i ++) {
+        err = boundedrnd64(kiss64, seeds, &usample, 1000);
+        fprintf(file, "%llu\n", (unsigned long long)usample);
+    }
+    fclose(file);
 
 
 
@@ -13,6 +13,20 @@ fclose(fid);
 
 [h, p, k] = kstest2(data, unifrnd(0, 1, length(data), 1))
 
+disp('Uniform, native 64-bit XORSHIFT');
+fid = fopen('testdata/unif01_xorshift64w.txt', 'r');
+data = fscanf(fid, '%f');
+fclose(fid);
+
+[h, p, k] = kstest2(data, unifrnd(0, 1, length(data), 1))
+
+disp('Uniform, native 64-bit KISS');
+fid = fopen('testdata/unif01_kiss64w.txt', 'r');
+data = fscanf(fid, '%f');
+fclose(fid);
+
+[h, p, k] = kstest2(data, unifrnd(0, 1, length(data), 1))
+
 disp('Transformations using the KISS generator');
 disp('Exponential');
 fid = fopen('testdata/exp1_64.txt', 'r');
@@ -21,6 +35,13 @@ fclose(fid);
 
 [h, p, k] = kstest2(data, exprnd(1, length(data), 1))
 
+disp('Exponential, Ziggurat');
+fid = fopen('testdata/expzig1_64.txt', 'r');
+data = fscanf(fid, '%f');
+fclose(fid);
+
+[h, p, k] = kstest2(data, exprnd(1, length(data), 1))
+
 disp('Standard normal');
 fid = fopen('testdata/normstd_64.txt', 'r');
 data = fscanf(fid, '%f');
@@ -42,6 +63,41 @@ fclose(fid);
 
 [h, p, k] = kstest2(data, binornd(20, 0.5, length(data), 1))
 
+disp('binomial, Bernoulli bits');
+fid = fopen('testdata/bino903_64.txt', 'r');
+data = fscanf(fid, '%d');
+fclose(fid);
+
+[h, p, k] = kstest2(data, binornd(9, 0.3, length(data), 1))
+
+disp('binomial, BTPE');
+fid = fopen('testdata/bino100003_64.txt', 'r');
+data = fscanf(fid, '%d');
+fclose(fid);
+
+[h, p, k] = kstest2(data, binornd(1000, 0.3, length(data), 1))
+
+disp('Standard normal, Ziggurat')
+fid = fopen('testdata/normstdzig_64.txt', 'r');
+data = fscanf(fid, '%f');
+fclose(fid);
+
+[h, p, k] = kstest2(data, normrnd(0, 1, length(data), 1))
+
+disp('Normal, Ziggurat');
+fid = fopen('testdata/normzig55_64.txt', 'r');
+data = fscanf(fid, '%f');
+fclose(fid);
+
+[h, p, k] = kstest2(data, normrnd(5, 5, length(data), 1))
+
+disp('Standard normal, batched Box-Muller')
+fid = fopen('testdata/normstdfill_64.txt', 'r');
+data = fscanf(fid, '%f');
+fclose(fid);
+
+[h, p, k] = kstest2(data, normrnd(0, 1, length(data), 1))
+
 disp('Poisson');
 fid = fopen('testdata/poiss5_64.txt', 'r');
 data = fscanf(fid, '%f');
@@ -49,6 +105,13 @@ fclose(fid);
 
 [h, p, k] = kstest2(data, poissrnd(5,  length(data), 1))
 
+disp('Poisson, PTRS');
+fid = fopen('testdata/poiss100_64.txt', 'r');
+data = fscanf(fid, '%f');
+fclose(fid);
+
+[h, p, k] = kstest2(data, poissrnd(100,  length(data), 1))
+
 disp('Gamma');
 fid = fopen('testdata/gamm51_64.txt', 'r');
 data = fscanf(fid, '%f');
@@ -63,3 +126,24 @@ data = fscanf(fid, '%f');
 fclose(fid);
 
 [h, p, k] = kstest2(data, betarnd(2, 5,  length(data), 1))
+
+disp('Gamma, parallel fill')
+fid = fopen('testdata/gamm51par_64.txt', 'r');
+data = fscanf(fid, '%f');
+fclose(fid);
+
+[h, p, k] = kstest2(data, gamrnd(5, 1,  length(data), 1))
+
+disp('Beta, prepared distribution')
+fid = fopen('testdata/beta25dist_64.txt', 'r');
+data = fscanf(fid, '%f');
+fclose(fid);
+
+[h, p, k] = kstest2(data, betarnd(2, 5,  length(data), 1))
+
+disp('Uniform integers on [0, 1000)')
+fid = fopen('testdata/int1000_64.txt', 'r');
+data = fscanf(fid, '%d');
+fclose(fid);
+
+[h, p, k] = kstest2(data, randi([0 999], length(data), 1))
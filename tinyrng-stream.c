@@ -0,0 +1,440 @@
+// Raw binary output of the generators and transformations
+//
+// usage: tinyrng-stream [-g generator] [-s seed] [-i stream] [-j k]
+//                       [-d distribution] [-t type] [-a a] [-b b]
+//                       [-n bytes] [-o file] [-v]
+//
+//   -g  xorshift32 (default), kiss32, xorshift64w, kiss64w, philox,
+//       xorshift32vec
+//   -s  64-bit master seed, read from the system if not given
+//   -i  stream index of the stream manager, see streaminit
+//   -j  jump ahead by 2^k steps after selecting the stream
+//   -d  raw (default), unif, norm, exp, gamma, beta, poisson, binomial
+//   -t  u32 (default for raw), u64, f32 (default otherwise), f64
+//   -a  first parameter of the distribution, see distinit
+//   -b  second parameter of the distribution
+//   -n  stop after this many bytes, e.g. 1e9, endless by default
+//   -o  write to file instead of stdout
+//   -v  print the seed and settings to stderr
+//
+// u32/u64 are the generator words, f32/f64 the 32-bit and 64-bit
+// transformations, written in host byte order without any formatting,
+// e.g. for PractRand "tinyrng-stream | RNG_test stdin32". Output is
+// generated into page aligned buffers. If stdout is a pipe the buffers
+// are handed to the pipe by vmsplice without copying, otherwise they
+// are written by write. The stream ends quietly when the reader closes
+// the pipe.
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include "TinyRNG.h"
+
+#define BUFFER_SIZE (1 << 20)
+#define NBUFFERS 3
+#define PAGE 4096
+
+typedef struct {
+    const char *name;
+    uint32_t words;
+    uint32_t streams;
+    uint32_t (*seed)(uint32_t *seeds, uint64_t s);
+    uint32_t (*jump)(uint32_t *seeds, uint32_t k);
+    uint32_t (*next32)(uint32_t *seeds, uint32_t *sample);
+    uint32_t (*next64)(uint32_t *seeds, uint64_t *sample);
+    uint32_t (*fill32)(uint32_t *seeds, uint32_t *samples, uint32_t n);
+    uint32_t (*fill64)(uint32_t *seeds, uint64_t *samples, uint32_t n);
+} streamgen;
+
+typedef struct {
+    const char *name;
+    uint32_t distribution;
+    double a, b;
+} streamdist;
+
+
+/*
+ * Adapters to the common signatures
+ */
+static uint32_t seedXorshift32(uint32_t *seeds, uint64_t s) { return(seedfrom(seeds, 5, s)); }
+
+// the seed is the key, the stream starts at counter 0
+static uint32_t seedPhilox(uint32_t *seeds, uint64_t s) { return(seedphilox(seeds, s, 0)); }
+
+
+// 32-bit words of the 64-bit generators, the upper half of each word
+static uint32_t xorshift64wHigh(uint32_t *seeds, uint32_t *sample) {
+    uint64_t w;
+    uint32_t _err = xorshift64w(seeds, &w);
+
+    *sample = (uint32_t)(w >> 32);
+    return(_err);
+}
+
+
+static uint32_t kiss64wHigh(uint32_t *seeds, uint32_t *sample) {
+    uint64_t w;
+    uint32_t _err = kiss64w(seeds, &w);
+
+    *sample = (uint32_t)(w >> 32);
+    return(_err);
+}
+
+
+// words converted at a time, a multiple of TINYRNG_VEC_LANES
+#define STREAM_CHUNK 512
+
+
+// n 32-bit words from n / 2 64-bit words, low half first, and the upper
+// half of one more for odd n
+static uint32_t fill32from64(uint32_t (*fill64)(uint32_t *, uint64_t *, uint32_t), uint32_t *seeds, uint32_t *samples, uint32_t n) {
+    uint64_t w[STREAM_CHUNK];
+    uint32_t i, j, m;
+    uint32_t _err = 0;
+
+    for(i = 0; i < n / 2; i += m) {
+        m = n / 2 - i < STREAM_CHUNK ? n / 2 - i : STREAM_CHUNK;
+        _err |= fill64(seeds, w, m);
+        for(j = 0; j < m; j++) {
+            samples[2 * (i + j)] = (uint32_t)w[j];
+            samples[2 * (i + j) + 1] = (uint32_t)(w[j] >> 32);
+        }
+    }
+
+    if(n & 1) {
+        _err |= fill64(seeds, w, 1);
+        samples[n - 1] = (uint32_t)(w[0] >> 32);
+    }
+    return(_err);
+}
+
+
+static uint32_t xorshift64wfill32(uint32_t *seeds, uint32_t *samples, uint32_t n) {
+    return(fill32from64(xorshift64wfill, seeds, samples, n));
+}
+
+
+static uint32_t kiss64wfill32(uint32_t *seeds, uint32_t *samples, uint32_t n) {
+    return(fill32from64(kiss64wfill, seeds, samples, n));
+}
+
+
+// 64-bit words of the multi-lane engine, two consecutive 32-bit words as xorshift64
+static uint32_t xorshift32vecfill64(uint32_t *seeds, uint64_t *samples, uint32_t n) {
+    uint32_t w[2 * STREAM_CHUNK];
+    uint32_t i, j, m;
+    uint32_t _err = 0;
+
+    for(i = 0; i < n; i += m) {
+        m = n - i < STREAM_CHUNK ? n - i : STREAM_CHUNK;
+        _err |= xorshift32vecfill(seeds, w, 2 * m);
+        for(j = 0; j < m; j++) {
+            samples[i + j] = ((uint64_t)w[2 * j] << 32) + w[2 * j + 1];
+        }
+    }
+    return(_err);
+}
+
+
+static const streamgen generators[] = {
+    {"xorshift32", 5, TINYRNG_XORSHIFT32, seedXorshift32, xorshift32jump, xorshift32, xorshift64, xorshift32fill, xorshift64fill},
+    {"kiss32", 5, TINYRNG_KISS32, seedkissfrom, kiss32jump, kiss32, kiss64, kiss32fill, kiss64fill},
+    {"xorshift64w", 4, 0, seedxorshift64wfrom, NULL, xorshift64wHigh, xorshift64w, xorshift64wfill32, xorshift64wfill},
+    {"kiss64w", 8, 0, seedkiss64wfrom, NULL, kiss64wHigh, kiss64w, kiss64wfill32, kiss64wfill},
+    {"philox", TINYRNG_PHILOX_WORDS, 0, seedPhilox, NULL, philox32, philox64, philox32fill, philox64fill},
+    {"xorshift32vec", 5 * TINYRNG_VEC_LANES, 0, seedxorshift32vecfrom, NULL, NULL, NULL, xorshift32vecfill, xorshift32vecfill64},
+};
+
+static const streamdist distributions[] = {
+    {"raw", 0, 0, 0},
+    {"unif", 0, 0, 0},
+    {"norm", TINYRNG_NORMAL, 0, 1},
+    {"exp", TINYRNG_EXP, 1, 0},
+    {"gamma", TINYRNG_GAMMA, 1, 1},
+    {"beta", TINYRNG_BETA, 1, 1},
+    {"poisson", TINYRNG_POISSON, 1, 0},
+    {"binomial", TINYRNG_BINOMIAL, 1, 0.5},
+};
+
+#define NGENERATORS (sizeof(generators) / sizeof(generators[0]))
+#define NDISTRIBUTIONS (sizeof(distributions) / sizeof(distributions[0]))
+
+// output types
+#define OUT_U32 1
+#define OUT_U64 2
+#define OUT_F32 3
+#define OUT_F64 4
+
+
+/*
+ * Generation of one buffer of n bytes, n a multiple of 8
+ */
+static uint32_t generate(const streamgen *g, const streamdist *d, const rngdist *dist, uint32_t type, uint32_t *seeds, void *buf, uint32_t n) {
+    uint32_t _err = TINYRNG_OK;
+    uint32_t i;
+
+    switch(type) {
+        case OUT_U32:
+            return(g->fill32(seeds, (uint32_t *)buf, n / 4));
+
+        case OUT_U64:
+            return(g->fill64(seeds, (uint64_t *)buf, n / 8));
+
+        case OUT_F32:
+            if(d->distribution == 0) {
+                return(unifrnd32fill(g->fill32, seeds, (float *)buf, n / 4));
+            }
+            if(d->distribution == TINYRNG_NORMAL) {
+                float *f = (float *)buf;
+
+                _err = normstdrnd32fill(g->fill32, seeds, f, n / 4);
+                for(i = 0; i < n / 4; i++) {
+                    f[i] = dist->par.norm.mu + dist->par.norm.sigma * f[i];
+                }
+                return(_err);
+            }
+            return(distfill32(g->next32, seeds, dist, (float *)buf, n / 4));
+
+        case OUT_F64:
+            if(d->distribution == 0) {
+                return(unifrnd64fill(g->fill64, seeds, (double *)buf, n / 8));
+            }
+            if(d->distribution == TINYRNG_NORMAL) {
+                double *f = (double *)buf;
+
+                _err = normstdrnd64fill(g->fill64, seeds, f, n / 8);
+                for(i = 0; i < n / 8; i++) {
+                    f[i] = dist->par.norm.mu + dist->par.norm.sigma * f[i];
+                }
+                return(_err);
+            }
+            return(distfill64(g->next64, seeds, dist, (double *)buf, n / 8));
+    }
+    return(TINYRNG_INTERVAL_ERROR);
+}
+
+
+/*
+ * Output, returns 0 when written, 1 when the reader has gone, -1 on error
+ */
+static int writeAll(int fd, const char *buf, size_t n) {
+    ssize_t w;
+
+    while(n > 0) {
+        w = write(fd, buf, n);
+        if(w < 0) {
+            if(errno == EINTR) {
+                continue;
+            }
+            return(errno == EPIPE ? 1 : -1);
+        }
+        buf += w;
+        n -= (size_t)w;
+    }
+    return(0);
+}
+
+
+// the pages stay referenced by the pipe until read, see the buffer rotation in main
+static int spliceAll(int fd, const char *buf, size_t n) {
+    struct iovec iov;
+    ssize_t w;
+
+    while(n > 0) {
+        iov.iov_base = (void *)buf;
+        iov.iov_len = n;
+        w = vmsplice(fd, &iov, 1, 0);
+        if(w < 0) {
+            if(errno == EINTR) {
+                continue;
+            }
+            return(errno == EPIPE ? 1 : -1);
+        }
+        buf += w;
+        n -= (size_t)w;
+    }
+    return(0);
+}
+
+
+static void usage(const char *prog) {
+    fprintf(stderr, "usage: %s [-g generator] [-s seed] [-i stream] [-j k] [-d distribution] [-t type] [-a a] [-b b] [-n bytes] [-o file] [-v]\n", prog);
+}
+
+
+int main(int argc, char **argv) {
+    const streamgen *g = &generators[0];
+    const streamdist *d = &distributions[0];
+    const char *path = NULL;
+    rngdist dist;
+    rngstreams streams;
+    uint32_t seeds[5 * TINYRNG_VEC_LANES] __attribute__((aligned(64)));
+    uint32_t master32[2];
+    uint64_t master = 0, stream = 0, limit = UINT64_MAX, done = 0;
+    uint32_t type = 0, jump = 0, haveSeed = 0, haveStream = 0, haveJump = 0, verbose = 0;
+    double a = NAN, b = NAN;
+    char *buffers[NBUFFERS];
+    size_t size = BUFFER_SIZE, n;
+    struct stat st;
+    int fd = STDOUT_FILENO, usesplice = 0, opt, r = 0;
+    uint32_t i, _err = TINYRNG_OK;
+
+    while((opt = getopt(argc, argv, "g:s:i:j:d:t:a:b:n:o:v")) != -1) {
+        switch(opt) {
+            case 'g':
+                for(i = 0; i < NGENERATORS && strcmp(optarg, generators[i].name) != 0; i++);
+                if(i == NGENERATORS) {
+                    fprintf(stderr, "unknown generator %s\n", optarg);
+                    return(1);
+                }
+                g = &generators[i];
+                break;
+            case 'd':
+                for(i = 0; i < NDISTRIBUTIONS && strcmp(optarg, distributions[i].name) != 0; i++);
+                if(i == NDISTRIBUTIONS) {
+                    fprintf(stderr, "unknown distribution %s\n", optarg);
+                    return(1);
+                }
+                d = &distributions[i];
+                break;
+            case 't':
+                if(strcmp(optarg, "u32") == 0) type = OUT_U32;
+                else if(strcmp(optarg, "u64") == 0) type = OUT_U64;
+                else if(strcmp(optarg, "f32") == 0) type = OUT_F32;
+                else if(strcmp(optarg, "f64") == 0) type = OUT_F64;
+                else {
+                    fprintf(stderr, "unknown type %s\n", optarg);
+                    return(1);
+                }
+                break;
+            case 's': master = strtoull(optarg, NULL, 0); haveSeed = 1; break;
+            case 'i': stream = strtoull(optarg, NULL, 0); haveStream = 1; break;
+            case 'j': jump = (uint32_t)strtoul(optarg, NULL, 0); haveJump = 1; break;
+            case 'a': a = strtod(optarg, NULL); break;
+            case 'b': b = strtod(optarg, NULL); break;
+            case 'n': limit = (uint64_t)strtod(optarg, NULL); break;
+            case 'o': path = optarg; break;
+            case 'v': verbose = 1; break;
+            default:
+                usage(argv[0]);
+                return(1);
+        }
+    }
+    if(optind < argc) {
+        usage(argv[0]);
+        return(1);
+    }
+
+    // check the combination of options
+    if(type == 0) {
+        type = strcmp(d->name, "raw") == 0 ? OUT_U32 : OUT_F32;
+    }
+    if(strcmp(d->name, "raw") == 0 && (type == OUT_F32 || type == OUT_F64)) {
+        d = &distributions[1];
+    }
+    if(strcmp(d->name, "raw") != 0 && (type == OUT_U32 || type == OUT_U64)) {
+        fprintf(stderr, "u32 and u64 are the raw generator words, use f32 or f64 for %s\n", d->name);
+        return(1);
+    }
+    if(g->next32 == NULL && d->distribution != 0 && d->distribution != TINYRNG_NORMAL) {
+        fprintf(stderr, "%s only supports raw, unif and norm\n", g->name);
+        return(1);
+    }
+    if((haveStream || haveJump) && g->streams == 0) {
+        fprintf(stderr, "%s has no streams or jumps\n", g->name);
+        return(1);
+    }
+
+    // seeding
+    if(!haveSeed) {
+        _err = getSeeds(master32, 2);
+        master = ((uint64_t)master32[0] << 32) | master32[1];
+    }
+    if(_err == TINYRNG_OK) {
+        if(haveStream) {
+            _err = streaminit(&streams, g->streams, master);
+            _err |= streamget(&streams, stream, seeds);
+        } else {
+            _err = g->seed(seeds, master);
+        }
+    }
+    if(_err == TINYRNG_OK && haveJump) {
+        _err = g->jump(seeds, jump);
+    }
+    if(_err == TINYRNG_OK && d->distribution != 0) {
+        _err = distinit(&dist, d->distribution, isnan(a) ? d->a : a, isnan(b) ? d->b : b);
+    }
+    if(_err != TINYRNG_OK) {
+        fprintf(stderr, "set-up failed with error %u\n", _err);
+        return(1);
+    }
+    if(verbose) {
+        fprintf(stderr, "generator %s, seed %llu, stream %llu, jump 2^%u, distribution %s (%g, %g), type %s\n",
+            g->name, (unsigned long long)master, (unsigned long long)stream, haveJump ? jump : 0, d->name,
+            isnan(a) ? d->a : a, isnan(b) ? d->b : b,
+            type == OUT_U32 ? "u32" : (type == OUT_U64 ? "u64" : (type == OUT_F32 ? "f32" : "f64")));
+    }
+
+    // output
+    if(path != NULL) {
+        fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if(fd < 0) {
+            perror(path);
+            return(1);
+        }
+    }
+    signal(SIGPIPE, SIG_IGN);
+    if(fstat(fd, &st) == 0 && S_ISFIFO(st.st_mode)) {
+        int p;
+
+        // a buffer is reused after NBUFFERS - 1 more buffers have been
+        // spliced, so the pipe must not hold more than one buffer
+        fcntl(fd, F_SETPIPE_SZ, BUFFER_SIZE);
+        p = fcntl(fd, F_GETPIPE_SZ);
+        if(p > 0 && p <= BUFFER_SIZE) {
+            size = (size_t)p;
+            usesplice = 1;
+        }
+    }
+    for(i = 0; i < NBUFFERS; i++) {
+        void *mem = NULL;
+
+        if(posix_memalign(&mem, PAGE, size) != 0) {
+            fprintf(stderr, "out of memory\n");
+            return(1);
+        }
+        buffers[i] = (char *)mem;
+    }
+
+    for(i = 0; r == 0 && done < limit; i = (i + 1) % NBUFFERS) {
+        n = (limit - done) < size ? (size_t)(limit - done) : size;
+        _err = generate(g, d, &dist, type, seeds, buffers[i], (uint32_t)((n + 7) & ~(size_t)7));
+        if(_err != TINYRNG_OK) {
+            fprintf(stderr, "generation failed with error %u\n", _err);
+            return(1);
+        }
+        r = usesplice && n == size ? spliceAll(fd, buffers[i], n) : writeAll(fd, buffers[i], n);
+        done += n;
+    }
+    if(r < 0) {
+        perror("tinyrng-stream");
+        return(1);
+    }
+
+    for(i = 0; i < NBUFFERS; i++) {
+        free(buffers[i]);
+    }
+    if(path != NULL) {
+        close(fd);
+    }
+    return(0);
+}
@@ -1,8 +1,32 @@
 #include <stdint.h>
 #include <math.h>
 #include <fcntl.h>
+#include <errno.h>
+#include <unistd.h>
 #include <TinyRNG.h>
 
+// the generators and basic transformations, compiled as external functions
+#define TINYRNG_API
+#include <TinyRNGinline.h>
+
+/*
+ * The standard normal sampler behind normrnd and gammarnd.
+ */
+#ifdef TINYRNG_ZIGGURAT
+#define NORMSTD32(u, seeds, sample, u2) normstdzig32(u, seeds, sample)
+#define NORMSTD64(u, seeds, sample, u2) normstdzig64(u, seeds, sample)
+#else
+#define NORMSTD32(u, seeds, sample, u2) normstdrnd32(u, seeds, sample, u2)
+#define NORMSTD64(u, seeds, sample, u2) normstdrnd64(u, seeds, sample, u2)
+#endif
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<sys/random.h>)
+#include <sys/random.h>
+#define TINYRNG_GETRANDOM 1
+#endif
+#endif
+
 /**************************************************************************
  *  This file is part of TinyRNG. Copyright Guido Klingbeil (2013).
  *
@@ -21,29 +45,60 @@
  *************************************************************************/
 
 
+/*
+ * Fill l seed words from the operating system in one go. This is the
+ * platform dependent bit. getrandom() needs no file descriptor and a
+ * single system call for the whole array, if it is not available we
+ * fall back to one read from /dev/urandom.
+ */
+uint32_t getSeeds(uint32_t *seeds, uint32_t l) {
+    uint8_t *buf = (uint8_t *)seeds;
+    size_t len = (size_t)l * sizeof(uint32_t);
+    ssize_t r;
+    int32_t fn;
+
+#ifdef TINYRNG_GETRANDOM
+    while(len > 0) {
+        r = getrandom(buf, len, 0);
+        if(r < 0) {
+            if(errno == EINTR) continue;
+            break;
+        }
+        buf += r;
+        len -= r;
+    }
+    if(len == 0) {
+        return(0);
+    }
+#endif
+
+    fn = open("/dev/urandom", O_RDONLY);
+    if(fn == -1) {
+        return(TINYRNG_SEED_ERROR);
+    }
+
+    while(len > 0) {
+        r = read(fn, buf, len);
+        if(r <= 0) {
+            if(r < 0 && errno == EINTR) continue;
+            close(fn);
+            return(TINYRNG_SEED_ERROR);
+        }
+        buf += r;
+        len -= r;
+    }
+
+    close(fn);
+
+    return(0);
+}
+
+
 /*
  * Generate a single 32-bit seed for the the RNG.
- * This is the platform dependent bit since we 
- * read 4 bytes from /dev/urandom.
  */
 uint32_t getSeed(uint32_t *seed) {
-   int32_t fn;
-   uint32_t r;
-   
-   fn = open("/dev/urandom", O_RDONLY);
-   if(fn == -1) {
-       return(TINYRNG_SEED_ERROR);
-   }
-   
-   if(read(fn, &r, 4) != 4) {
-       return(TINYRNG_SEED_ERROR);
-   }
-   
-   close(fn);
-   
-   *seed = r;
-
-   return(0);
+    return(getSeeds(seed, 1));
 }
 
 
@@ -52,15 +107,7 @@ uint32_t getSeed(uint32_t *seed) {
  * Simply filling up the seed array.
  */
 uint32_t seed(uint32_t *seeds, uint32_t l) {
-	uint32_t _i;
-        uint32_t _err = 0;
-
-	for (_i = 0; _i < l; _i++) {
-		_err = getSeed(&seeds[_i]);
-                if(_err) break;
-	}
-
-	return(_err);
+    return(getSeeds(seeds, l));
 }
 
 
@@ -70,246 +117,755 @@ uint32_t seed(uint32_t *seeds, uint32_t l) {
  * bit and we do not need to seed it.
  */
 uint32_t seedkiss(uint32_t *seeds) {
-    uint32_t _i;
     uint32_t _err = 0;
 
-    _err = getSeed(&seeds[0]);
+    _err = getSeeds(seeds, 4);
     if(_err) return(_err);
 
     while(seeds[1] == 0) {
         _err = getSeed(&seeds[1]);
         if(_err) return(_err);
     }
-	
-    _err = getSeed(&seeds[2]);
-    if(_err) return(_err);
 
-    _err = getSeed(&seeds[3]);
+    return(_err);
+}
+
+
+/*
+ * xorshift128+ must not start from the all zero state.
+ */
+uint32_t seedxorshift64w(uint32_t *seeds) {
+    uint32_t _err = 0;
+
+    do {
+        _err = seed(seeds, 4);
+        if(_err) return(_err);
+    } while((seeds[0] | seeds[1] | seeds[2] | seeds[3]) == 0);
+
+    return(_err);
+}
+
+
+/*
+ * 64-bit KISS: seeds[0..1] is the MWC value x, seeds[2..3] the MWC carry c,
+ * seeds[4..5] the XORSHIFT value y and seeds[6..7] the congruential value z.
+ * The carry has to stay below the multiplier 2^58 + 1, x and c must not
+ * both be 0 and y must not be 0.
+ */
+uint32_t seedkiss64w(uint32_t *seeds) {
+    uint32_t _err = 0;
+
+    _err = seed(seeds, 8);
     if(_err) return(_err);
 
+    seeds[3] &= 0x03FFFFFF;
+
+    while((seeds[0] | seeds[1] | seeds[2] | seeds[3]) == 0) {
+        _err = seed(seeds, 2);
+        if(_err) return(_err);
+    }
+
+    while((seeds[4] | seeds[5]) == 0) {
+        _err = seed(&seeds[4], 2);
+        if(_err) return(_err);
+    }
+
     return(_err);
 }
 
 
 /*
- * RNG itself. We generate 32-bit of randomness in each iteration.
- * If 64-bits of randomness are required, we simple pad them together.
+ * Deterministic seeding from a single 64-bit value. The value is
+ * expanded by SplitMix64, each output gives two seed words, low word
+ * first. The same constraints as for the seeding functions above are
+ * enforced by drawing further outputs, so every 64-bit value yields
+ * a valid state.
+ *
+ * Reference:
+ * Steele, G. L., Lea, D. & Flood, C. H., "Fast splittable pseudorandom number generators",
+ * ACM SIGPLAN Notices, 2014, 49(10), 453-472
  */
+static uint64_t splitmix64(uint64_t *x) {
+    uint64_t z = (*x += 0x9E3779B97F4A7C15ULL);
+
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
 
-// 32-bit XORSHIFT RNG
-// this RNG uses 5 seeds, change the number of seeds changes the structure of the RNG
-uint32_t xorshift32(uint32_t *seeds, uint32_t *sample) {
-	uint32_t t;
+    return(z ^ (z >> 31));
+}
 
-	t = (seeds[0] ^ (seeds[0] >> 7));
-	seeds[0] = seeds[1];
-	seeds[1] = seeds[2];
-	seeds[2] = seeds[3];
-	seeds[3] = seeds[4];
-	seeds[4] = (seeds[4] ^ (seeds[4] << 6)) ^ (t ^ (t << 13));
-	*sample = (seeds[1] + seeds[1] + 1) * seeds[4];
 
-        return(0);
+static void splitmixFill(uint64_t *x, uint32_t *seeds, uint32_t l) {
+    uint64_t z = 0;
+    uint32_t i;
+
+    for(i = 0; i < l; i++) {
+        if((i & 1) == 0) {
+            z = splitmix64(x);
+            seeds[i] = (uint32_t)z;
+        } else {
+            seeds[i] = (uint32_t)(z >> 32);
+        }
+    }
+}
+
+
+// generic, l seeds which must not all be 0
+uint32_t seedfrom(uint32_t *seeds, uint32_t l, uint64_t s) {
+    uint64_t x = s;
+    uint32_t i, any;
+
+    do {
+        splitmixFill(&x, seeds, l);
+        for(i = 0, any = 0; i < l; i++) {
+            any |= seeds[i];
+        }
+    } while(l > 0 && any == 0);
+
+    return(0);
 }
 
 
-// this makes a rather unelegant appearence
-// I have to pass a pointer to the generator and
-// a second pointer to the seeds all the time
+// KISS, seeds[1] must not be 0, the carry seeds[4] is set as well
+uint32_t seedkissfrom(uint32_t *seeds, uint64_t s) {
+    uint64_t x = s;
 
-// 64-bit wrapper
-// calls the 32-bit generator twice
-uint32_t xorshift64(uint32_t *seeds, uint64_t *sample) {
-     uint32_t _err = 0;
-     uint32_t f1 = 0, f2 = 0;
+    splitmixFill(&x, seeds, 5);
+    seeds[4] &= 2147483647;
 
-     // generate 64-bits of randomness
-     _err = xorshift32(seeds, &f1);
-     _err = xorshift32(seeds, &f2);
-     
-     *sample = ((uint64_t)f1 << 32) + f2;
-     return(_err);
+    while(seeds[1] == 0) {
+        splitmixFill(&x, &seeds[1], 1);
+    }
+
+    return(0);
+}
+
+
+uint32_t seedxorshift64wfrom(uint32_t *seeds, uint64_t s) {
+    return(seedfrom(seeds, 4, s));
+}
+
+
+uint32_t seedkiss64wfrom(uint32_t *seeds, uint64_t s) {
+    uint64_t x = s;
+
+    splitmixFill(&x, seeds, 8);
+    seeds[3] &= 0x03FFFFFF;
+
+    while((seeds[0] | seeds[1] | seeds[2] | seeds[3]) == 0) {
+        splitmixFill(&x, seeds, 2);
+    }
+
+    while((seeds[4] | seeds[5]) == 0) {
+        splitmixFill(&x, &seeds[4], 2);
+    }
+
+    return(0);
 }
 
 
 /*
- * Marsaglia's KISS (Keep it simple, stupid) generators.
+ * Bulk versions of the generators above. The state is copied into
+ * locals so the compiler can keep it in registers for the whole loop
+ * and it is written back only once at the end. The update rules are
+ * exactly the ones of the scalar generators.
  */
-uint32_t kiss32(uint32_t *seeds, uint32_t *sample) {
-    uint32_t t = 0;
+uint32_t xorshift32fill(uint32_t *seeds, uint32_t *samples, uint32_t n) {
+    uint32_t s0 = seeds[0], s1 = seeds[1], s2 = seeds[2], s3 = seeds[3], s4 = seeds[4];
+    uint32_t t, i;
+
+    for(i = 0; i < n; i++) {
+        t = (s0 ^ (s0 >> 7));
+        s0 = s1;
+        s1 = s2;
+        s2 = s3;
+        s3 = s4;
+        s4 = (s4 ^ (s4 << 6)) ^ (t ^ (t << 13));
+        samples[i] = (s1 + s1 + 1) * s4;
+    }
 
-    seeds[1] ^= (seeds[1] << 5);
-    seeds[1] ^= (seeds[1] >> 7);
-    seeds[1] ^= (seeds[1] << 22);
-    t = seeds[2] + seeds[3] + seeds[4];
-    seeds[2] = seeds[3];
-    seeds[4] = t < 0;
-    seeds[4] = t & 2147483647;
-    seeds[0] += 1411392427;
-    *sample = seeds[0] + seeds[1] + seeds[3];
+    seeds[0] = s0;
+    seeds[1] = s1;
+    seeds[2] = s2;
+    seeds[3] = s3;
+    seeds[4] = s4;
 
     return(0);
 }
 
 
-uint32_t kiss64(uint32_t *seeds, uint64_t *sample) {
-     uint32_t _err = 0;
-     uint32_t f1 = 0, f2 = 0;
+// two 32-bit steps per sample, high word first as in xorshift64
+uint32_t xorshift64fill(uint32_t *seeds, uint64_t *samples, uint32_t n) {
+    uint32_t s0 = seeds[0], s1 = seeds[1], s2 = seeds[2], s3 = seeds[3], s4 = seeds[4];
+    uint32_t t, f1, i;
+
+    for(i = 0; i < n; i++) {
+        t = (s0 ^ (s0 >> 7));
+        s0 = s1;
+        s1 = s2;
+        s2 = s3;
+        s3 = s4;
+        s4 = (s4 ^ (s4 << 6)) ^ (t ^ (t << 13));
+        f1 = (s1 + s1 + 1) * s4;
+
+        t = (s0 ^ (s0 >> 7));
+        s0 = s1;
+        s1 = s2;
+        s2 = s3;
+        s3 = s4;
+        s4 = (s4 ^ (s4 << 6)) ^ (t ^ (t << 13));
+
+        samples[i] = ((uint64_t)f1 << 32) + (s1 + s1 + 1) * s4;
+    }
+
+    seeds[0] = s0;
+    seeds[1] = s1;
+    seeds[2] = s2;
+    seeds[3] = s3;
+    seeds[4] = s4;
 
-     // generate 64-bits of randomness
-     _err = kiss32(seeds, &f1);
-     _err = kiss32(seeds, &f2);
-     
-     *sample = ((uint64_t)f1 << 32) + f2;
-     return(_err);
+    return(0);
 }
 
-// -----------------
-// transformations
-// -----------------
 
-// uniform random sample on (0, 1]
-uint32_t unifrnd32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, float *sample) {
-    uint32_t _err = 0;    
-    uint32_t f1 = 0;
-    float f2 = 0.0f;
+uint32_t kiss32fill(uint32_t *seeds, uint32_t *samples, uint32_t n) {
+    uint32_t s0 = seeds[0], s1 = seeds[1], s2 = seeds[2], s3 = seeds[3], s4 = seeds[4];
+    uint32_t t, i;
 
-    _err = u(seeds, &f1);
+    for(i = 0; i < n; i++) {
+        s1 ^= (s1 << 5);
+        s1 ^= (s1 >> 7);
+        s1 ^= (s1 << 22);
+        t = s2 + s3 + s4;
+        s2 = s3;
+        s4 = t & 2147483647;
+        s0 += 1411392427;
+        samples[i] = s0 + s1 + s3;
+    }
 
-    // convert to float
+    seeds[0] = s0;
+    seeds[1] = s1;
+    seeds[2] = s2;
+    seeds[3] = s3;
+    seeds[4] = s4;
 
-    // the fraction of a single precision floating point number is 23 bits
-    f1 = f1 >> 9;
+    return(0);
+}
 
-    // set the exponent to 127, since 2(127 - 127) = 1
-    *((uint32_t *) &f2) = f1 | 0x3F800000;
-    *sample = f2 - 1.0f;
 
-    return(_err);
+// two 32-bit steps per sample, high word first as in kiss64
+uint32_t kiss64fill(uint32_t *seeds, uint64_t *samples, uint32_t n) {
+    uint32_t s0 = seeds[0], s1 = seeds[1], s2 = seeds[2], s3 = seeds[3], s4 = seeds[4];
+    uint32_t t, f1, i;
+
+    for(i = 0; i < n; i++) {
+        s1 ^= (s1 << 5);
+        s1 ^= (s1 >> 7);
+        s1 ^= (s1 << 22);
+        t = s2 + s3 + s4;
+        s2 = s3;
+        s4 = t & 2147483647;
+        s0 += 1411392427;
+        f1 = s0 + s1 + s3;
+
+        s1 ^= (s1 << 5);
+        s1 ^= (s1 >> 7);
+        s1 ^= (s1 << 22);
+        t = s2 + s3 + s4;
+        s2 = s3;
+        s4 = t & 2147483647;
+        s0 += 1411392427;
+
+        samples[i] = ((uint64_t)f1 << 32) + (s0 + s1 + s3);
+    }
+
+    seeds[0] = s0;
+    seeds[1] = s1;
+    seeds[2] = s2;
+    seeds[3] = s3;
+    seeds[4] = s4;
+
+    return(0);
 }
 
 
-uint32_t unifrnd64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, double *sample) {
-    uint32_t _err = 0;
-    uint64_t f1 = 0;
-    double f2 = 0.0;
+uint32_t xorshift64wfill(uint32_t *seeds, uint64_t *samples, uint32_t n) {
+    uint64_t s0 = ((uint64_t)seeds[1] << 32) | seeds[0];
+    uint64_t s1 = ((uint64_t)seeds[3] << 32) | seeds[2];
+    uint64_t t;
+    uint32_t i;
 
-    // generate 64-bits of randomness
-    _err = u(seeds, &f1);
+    for(i = 0; i < n; i++) {
+        t = s0;
+        s0 = s1;
+        t ^= t << 23;
+        s1 = t ^ s0 ^ (t >> 18) ^ (s0 >> 5);
+        samples[i] = s1 + s0;
+    }
 
-    // convert to double
+    seeds[0] = (uint32_t)s0;
+    seeds[1] = (uint32_t)(s0 >> 32);
+    seeds[2] = (uint32_t)s1;
+    seeds[3] = (uint32_t)(s1 >> 32);
 
-    // the mantissa of normalised floating point values is always > 1
-    // so we have to shift it by 1.0
-    f1 = (f1 >> 12) | 0x3FF0000000000000ULL; /* Take upper 52 bits */
-    *((uint64_t *)&f2) = f1; /* Make a double from bits */
-    *sample = f2 - 1.0;
+    return(0);
+}
 
-    return(_err);
+
+uint32_t kiss64wfill(uint32_t *seeds, uint64_t *samples, uint32_t n) {
+    uint64_t x = ((uint64_t)seeds[1] << 32) | seeds[0];
+    uint64_t c = ((uint64_t)seeds[3] << 32) | seeds[2];
+    uint64_t y = ((uint64_t)seeds[5] << 32) | seeds[4];
+    uint64_t z = ((uint64_t)seeds[7] << 32) | seeds[6];
+    uint64_t t;
+    uint32_t i;
+
+    for(i = 0; i < n; i++) {
+        t = (x << 58) + c;
+        c = x >> 6;
+        x += t;
+        c += (x < t);
+
+        y ^= y << 13;
+        y ^= y >> 17;
+        y ^= y << 43;
+
+        z = 6906969069ULL * z + 1234567;
+
+        samples[i] = x + y + z;
+    }
+
+    seeds[0] = (uint32_t)x;
+    seeds[1] = (uint32_t)(x >> 32);
+    seeds[2] = (uint32_t)c;
+    seeds[3] = (uint32_t)(c >> 32);
+    seeds[4] = (uint32_t)y;
+    seeds[5] = (uint32_t)(y >> 32);
+    seeds[6] = (uint32_t)z;
+    seeds[7] = (uint32_t)(z >> 32);
+
+    return(0);
 }
 
 
-// 32-bit uniform random sample on (a, b]
-uint32_t unifrndint32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, float *sample, float a, float b) {
-    uint32_t _err = 0;
-    float f = 0.0f;
+/*
+ * Jump ahead. Both XORSHIFT generators are linear over GF(2), so 2^k steps
+ * are the same as applying j(T) to the state, where T is the transition
+ * matrix and j(x) = x^(2^k) mod P(x) with P the characteristic polynomial
+ * of T (Cayley-Hamilton). Bit i of the tables below is the coefficient of
+ * x^i in j(x).
+ *
+ * The characteristic polynomial of xorshift32 has degree 160:
+ * P(x) = x^160 + 0x00000001000FF30F00604345FE89D38F633F0001 (lower terms),
+ * the one of the XORSHIFT part of kiss32 has degree 32:
+ * P(x) = x^32 + 0x01F05D05 (lower terms).
+ * Both are primitive, so the tables repeat after 160 and 32 entries.
+ */
 
-    // check b > a
-    if(a <= b) return(TINYRNG_INTERVAL_ERROR);
+// x^(2^k) mod P for xorshift32, k = 0 ... 159, 3 x 64-bit words
+static const uint64_t xorshift32JumpPoly[160][3] = {
+    {0x0000000000000002ULL, 0x0000000000000000ULL, 0x0000000000000000ULL}, // 0
+    {0x0000000000000004ULL, 0x0000000000000000ULL, 0x0000000000000000ULL}, // 1
+    {0x0000000000000010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL}, // 2
+    {0x0000000000000100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL}, // 3
+    {0x0000000000010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL}, // 4
+    {0x0000000100000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL}, // 5
+    {0x0000000000000000ULL, 0x0000000000000001ULL, 0x0000000000000000ULL}, // 6
+    {0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000001ULL}, // 7
+    {0x28C2F93DD1AF4311ULL, 0x9EEFE7ED993B1248ULL, 0x00000000AB832081ULL}, // 8
+    {0x263A91670822E7E3ULL, 0x97BACBD843528B1CULL, 0x00000000714083ACULL}, // 9
+    {0xBBA51FEC4FC28296ULL, 0x51CC9D27BAF778C8ULL, 0x00000000F3FF0048ULL}, // 10
+    {0xCDDC3B7D6FA4B8DFULL, 0xACD55DA2865C5E0EULL, 0x0000000009F41537ULL}, // 11
+    {0x305A96D49EBCD007ULL, 0xCCD1D86955F1D8A0ULL, 0x000000004947CFE9ULL}, // 12
+    {0x903F2F1B124BB306ULL, 0x4D0488F1C29CACD6ULL, 0x00000000C516E46FULL}, // 13
+    {0x3B2639DCEAE30122ULL, 0x3865C8B8A02178F8ULL, 0x000000003F23367AULL}, // 14
+    {0x7A4BDA303C543169ULL, 0x57932A0383CC7FDAULL, 0x0000000075B92DD8ULL}, // 15
+    {0x098C057253FA31F3ULL, 0x6EB64D9CA7FA007DULL, 0x000000007CDA43AEULL}, // 16
+    {0xF426B6E28188944DULL, 0xFA3B3E20BF44FA19ULL, 0x0000000078E7D4EFULL}, // 17
+    {0x5F5F692B44B09C55ULL, 0x44EC404F10236A2CULL, 0x00000000C623E951ULL}, // 18
+    {0xE993FA164BE7833DULL, 0x785BC007CDFE43D0ULL, 0x0000000081EC81DFULL}, // 19
+    {0x98F5729C259DE99CULL, 0x15D5A44A76C2DE67ULL, 0x000000006017AAF9ULL}, // 20
+    {0x62A83D99614908F9ULL, 0xD161EC85D805D336ULL, 0x000000006B2272EDULL}, // 21
+    {0x0E6313AF867EDA06ULL, 0x688A1FBAD961AAB7ULL, 0x00000000EDA1AF96ULL}, // 22
+    {0x3FF65EFB2ECC6AADULL, 0x9169146D4AE124C1ULL, 0x000000008F7B4DD7ULL}, // 23
+    {0x61DAD807F0C71F29ULL, 0xA415833C2F903E8DULL, 0x000000000E45E55BULL}, // 24
+    {0x3E711E9D2F57619BULL, 0x130E2078DDF3992EULL, 0x000000000FBAB004ULL}, // 25
+    {0x041949AC3E6E909DULL, 0xF0B1AA8A9984CB74ULL, 0x000000008E6F6772ULL}, // 26
+    {0xA66F149359E01D62ULL, 0xD7A434873094E2BBULL, 0x000000002864DAC9ULL}, // 27
+    {0x7FDB4D3D2B75F11EULL, 0x193721071ED9815BULL, 0x000000003DC5CF00ULL}, // 28
+    {0x64096B8E4D7C0685ULL, 0x83499A9D7A014581ULL, 0x00000000005A9BEDULL}, // 29
+    {0x6D8A3E38E4002EE6ULL, 0x305ED02D075A59E7ULL, 0x00000000496D985BULL}, // 30
+    {0xBF6BFF81C0278CE4ULL, 0x36D4A689E8CBEBC2ULL, 0x0000000081986E06ULL}, // 31
+    {0xC63054FCA1B2B9BFULL, 0xD84CAA24F86F24FFULL, 0x00000000C9B703DFULL}, // 32
+    {0xA05B6C192279391EULL, 0x69606DA8A890FEACULL, 0x00000000A0BFB3A6ULL}, // 33
+    {0x5EFA216FC717934BULL, 0xBC490991462549B2ULL, 0x00000000252D97C9ULL}, // 34
+    {0xC495C72999D5AD45ULL, 0x4376256CCD8E6B50ULL, 0x00000000CA495DB1ULL}, // 35
+    {0xCB9D5252A8DAF4ACULL, 0x2546529D2EC755B8ULL, 0x00000000EFD09446ULL}, // 36
+    {0x580BB976D15C7364ULL, 0x6DBB40CD4469C5ADULL, 0x00000000741BCB5DULL}, // 37
+    {0x826E2BC5496BE31AULL, 0x613D318D3C6A78FAULL, 0x00000000CE4FFC76ULL}, // 38
+    {0xA96FC5A13BDECB53ULL, 0x8DAF9E8E09DCD5D8ULL, 0x00000000CD48433EULL}, // 39
+    {0x7E545D5095431981ULL, 0x9E593FF9D6D14FE8ULL, 0x00000000676C9D3CULL}, // 40
+    {0x680F6B7CA7E55542ULL, 0x321AAACB91883803ULL, 0x00000000ACE32F04ULL}, // 41
+    {0x569C24806A94B591ULL, 0x98EE7E2620073061ULL, 0x00000000540B1903ULL}, // 42
+    {0xEB4CE068712E159BULL, 0x3A502106A10AC38CULL, 0x0000000041D6F3FBULL}, // 43
+    {0x2897D880BE977EA1ULL, 0xCC4301A8BAB91105ULL, 0x000000007023D47CULL}, // 44
+    {0x36A03B87407D25FFULL, 0x7B704750FE819527ULL, 0x00000000234B65C9ULL}, // 45
+    {0xBED28D5DBD58D0C6ULL, 0x51C7AEA6F94931B9ULL, 0x0000000002542C58ULL}, // 46
+    {0xB739DBEF475C1B70ULL, 0x74C5FB5AEEC3E56FULL, 0x0000000007870BE2ULL}, // 47
+    {0x6C80CD81830BAA9AULL, 0xC7698C328F9DCE39ULL, 0x00000000744A74BAULL}, // 48
+    {0x1D983587EB4A7C29ULL, 0x3A56EAAA6F715E7DULL, 0x0000000050A25249ULL}, // 49
+    {0xC40EA8D9407109B1ULL, 0x6C93EC2015F5C987ULL, 0x00000000C18A15B8ULL}, // 50
+    {0x356BFA690F9EB2F9ULL, 0xC65215D1E0236ADDULL, 0x0000000091A64C61ULL}, // 51
+    {0x4C0EE22200027D9FULL, 0x4C9871F9FFE62162ULL, 0x0000000030734712ULL}, // 52
+    {0x8CC473FAB864BEDEULL, 0x7805052B33460CFFULL, 0x000000008D605118ULL}, // 53
+    {0x339D3239D7DE30CDULL, 0xC13F977B1FB89D96ULL, 0x000000004A55542BULL}, // 54
+    {0x917DFB3E2517469FULL, 0xA318A0413AB592F6ULL, 0x000000007403F5C3ULL}, // 55
+    {0x763F61157B034D7DULL, 0x7F4E4496AB7352E6ULL, 0x00000000D6D852BCULL}, // 56
+    {0x683664D860CD5A81ULL, 0xF1C12FA8007EF0A1ULL, 0x0000000068339900ULL}, // 57
+    {0x1C83E2248316368AULL, 0x8D092E9AB913C7E2ULL, 0x0000000085390B19ULL}, // 58
+    {0x8C58E5D9BBEF3D88ULL, 0xD3C85F3B4513FA9FULL, 0x0000000016ED8030ULL}, // 59
+    {0x19F69786D14245B2ULL, 0x6DDC9708929E45F6ULL, 0x00000000E5BEF2F1ULL}, // 60
+    {0x9AECCD13DD77E524ULL, 0xB3770D8A1A53567EULL, 0x00000000F1DC2CD6ULL}, // 61
+    {0x898A279429D67581ULL, 0x25173674F3A4A534ULL, 0x00000000ADD3BCE8ULL}, // 62
+    {0x9D174C46F8610EEAULL, 0xFB69327C9DE51966ULL, 0x000000006A2588EFULL}, // 63
+    {0x9BFE16206E682694ULL, 0x9A06D883D622072DULL, 0x00000000933318B4ULL}, // 64
+    {0x79B78AC70165F701ULL, 0x0D42CDF8CAD8F499ULL, 0x00000000DD8ABB4EULL}, // 65
+    {0xFEC4455879ABCB98ULL, 0xD3F681DC66869D35ULL, 0x00000000B02340D2ULL}, // 66
+    {0xC622EC098D8DE086ULL, 0xAD766DC2CC2B592FULL, 0x00000000D8978B2EULL}, // 67
+    {0x6E6D4E7E6B14B674ULL, 0x3BB5E41C6AF54827ULL, 0x000000007A3D5799ULL}, // 68
+    {0xB084EEEBF77868C7ULL, 0xFD05AFFCE0979DD5ULL, 0x00000000BE5ED8CEULL}, // 69
+    {0xE9CB318391DD3742ULL, 0x96C2DD0490AEB7ECULL, 0x000000009971D13CULL}, // 70
+    {0x515BB2D3BAAAE9F2ULL, 0x5672E0629ECC99C1ULL, 0x00000000C1BD3A0AULL}, // 71
+    {0xCDB8432EE247A857ULL, 0x758FD19E3D971E7EULL, 0x00000000D7DEF916ULL}, // 72
+    {0x926AC8B92712092EULL, 0x2B4457AD30817E23ULL, 0x00000000C1090553ULL}, // 73
+    {0xB73674E3F96CDAF6ULL, 0x39613B8658DBCF90ULL, 0x00000000AA479029ULL}, // 74
+    {0xC13816F02D0F190EULL, 0xA7C7172EA089306BULL, 0x00000000612F6DD2ULL}, // 75
+    {0x92B99F335B13A997ULL, 0x36BC02C1DED29F8BULL, 0x00000000583D1779ULL}, // 76
+    {0xDD159B1CDD740077ULL, 0xAC95E456A178D780ULL, 0x0000000056F8B3EDULL}, // 77
+    {0x1BC0906D018395B6ULL, 0x4CD49223527CED71ULL, 0x00000000E9A51204ULL}, // 78
+    {0x8F0C8E511CB05B68ULL, 0xF85B40A0A02F12DCULL, 0x000000005EF16079ULL}, // 79
+    {0x6279639DD6724291ULL, 0xF049FB5F9D3AE2A5ULL, 0x00000000E994E8E5ULL}, // 80
+    {0xFB94B400519B1317ULL, 0x9C8EA85BECE193CCULL, 0x000000005DFC863BULL}, // 81
+    {0x2A01BCDCE1CB5DA9ULL, 0x2B03725402EF9801ULL, 0x000000007374A5EAULL}, // 82
+    {0xE143473E569D54D6ULL, 0x0A69EE3FDA6A6A49ULL, 0x000000002528D35EULL}, // 83
+    {0x66EBF4BF808BED47ULL, 0xFAA1AC4451F0B09FULL, 0x0000000017685613ULL}, // 84
+    {0xF5D362F1336A20D3ULL, 0x7DF5C83CF658F938ULL, 0x0000000030508FF8ULL}, // 85
+    {0xF49876B5C37D0FEBULL, 0xC498BFFCF8D31D8CULL, 0x000000005AE49443ULL}, // 86
+    {0x96783A01173D7B84ULL, 0xA3660697C9F497E0ULL, 0x00000000B364DE0DULL}, // 87
+    {0x567B63D80C304CDFULL, 0xB264674C620C657DULL, 0x0000000087710029ULL}, // 88
+    {0xD114087BBDE1F238ULL, 0xBE0EA9112B3C1D89ULL, 0x00000000F77DB8E2ULL}, // 89
+    {0x6FB6E76C804465ECULL, 0x90ABC67EBBC9F10EULL, 0x0000000060A031FFULL}, // 90
+    {0x2B6DD007B10FD6A7ULL, 0x74193115EE7DED3EULL, 0x000000007D195D7EULL}, // 91
+    {0xE36A56BEA605995DULL, 0x6EEC6D7AB1837C33ULL, 0x00000000ABE7CE30ULL}, // 92
+    {0x873548C63203A751ULL, 0xCFD1EA6501798501ULL, 0x0000000071B20B78ULL}, // 93
+    {0xCB56D5387B15C07CULL, 0x89A3EFF795F2F175ULL, 0x000000000DDC900CULL}, // 94
+    {0xC309CC032734D5A8ULL, 0x3D84169DDE2F7B49ULL, 0x0000000021838F8BULL}, // 95
+    {0x88AD9E9D16EC4529ULL, 0x1E6F5B42221C6A52ULL, 0x000000000699CCE9ULL}, // 96
+    {0x3F46B08961DAD161ULL, 0x7D203CEBCD9A0113ULL, 0x00000000C609EB29ULL}, // 97
+    {0x06D287D12D6EA075ULL, 0xC4866EEEE225E612ULL, 0x000000000236B8B2ULL}, // 98
+    {0x4A9BE55DB0F1A412ULL, 0x9A38DB5312341E8CULL, 0x000000006F81EF6AULL}, // 99
+    {0xAFAE6377C5FC3899ULL, 0x1B3094AFE8976A01ULL, 0x00000000EAAE7FF4ULL}, // 100
+    {0x138ECC227FA6C825ULL, 0xCA9D56DCEC3744B2ULL, 0x0000000065F4B443ULL}, // 101
+    {0x54EAAD1CB66E390BULL, 0x2AC141010EB7725CULL, 0x000000008BEFB05EULL}, // 102
+    {0x2F209FA28550C417ULL, 0x9FAABECC7402254DULL, 0x0000000096CB8931ULL}, // 103
+    {0x5EC90EDB6F524E79ULL, 0x31498CB6962AB4C7ULL, 0x0000000033FAD0A3ULL}, // 104
+    {0xFC41F105F257D90AULL, 0xE55668AB91ABE049ULL, 0x00000000B91B2471ULL}, // 105
+    {0x3C1E08DBE646FE15ULL, 0xFED8FCDFD9BDD18CULL, 0x000000001310CA2FULL}, // 106
+    {0x6DDB8999FD1F2150ULL, 0x9152AA81C805B77BULL, 0x000000003B4615EEULL}, // 107
+    {0xE1E206CEBF537F77ULL, 0x2BA0CB41EF6F26B1ULL, 0x00000000E3B38316ULL}, // 108
+    {0x6AADDACE8AB4F02BULL, 0x07827B4DEEF750FEULL, 0x0000000024AAFEABULL}, // 109
+    {0xBE3303940137F5C7ULL, 0x4D510AB54485828AULL, 0x0000000012DCBE01ULL}, // 110
+    {0xAC873309F32AEB98ULL, 0xE952CE2CD953147EULL, 0x00000000B8648C2AULL}, // 111
+    {0x2F1AF41236E9CA3FULL, 0x5701C2952A6A1979ULL, 0x000000000EFE8068ULL}, // 112
+    {0xBE9238A03BB23B16ULL, 0x542A42FAF35106D6ULL, 0x00000000B361BB97ULL}, // 113
+    {0x561FB9D5D20CF5A3ULL, 0xE9DF239CBF7A3A0EULL, 0x00000000CA02A4A8ULL}, // 114
+    {0xE83A27666983992AULL, 0x6BD68518EAAA48B4ULL, 0x000000004AB48D3AULL}, // 115
+    {0xCF9D954AB230F22EULL, 0x4608E51E725E2E6AULL, 0x000000007335C224ULL}, // 116
+    {0x3DC271626932EC08ULL, 0x58CD2602F55CED6DULL, 0x00000000D5A8851CULL}, // 117
+    {0xCF87487085E46D5FULL, 0x4A21D0AF653759B3ULL, 0x0000000022DC4E05ULL}, // 118
+    {0xF460C66BD29AB422ULL, 0xA4F59BCF9B03FF26ULL, 0x0000000028AC68A1ULL}, // 119
+    {0x4B3009A8644F8653ULL, 0x4C9648D5C43805D3ULL, 0x00000000584AEEC3ULL}, // 120
+    {0x0D6206AECFCDC5BEULL, 0x9E299B804FE1DE20ULL, 0x00000000E5CF4846ULL}, // 121
+    {0x549BF59C984F2E12ULL, 0x8762F1661AC896C2ULL, 0x00000000B9639CA6ULL}, // 122
+    {0x50E09AD8B3D7C793ULL, 0x8CD124F53BDFD4FFULL, 0x00000000535D4DA9ULL}, // 123
+    {0xEA37AAD7760739AFULL, 0xA78A44303B759ED5ULL, 0x00000000F19A475CULL}, // 124
+    {0xC13586E6FE8C5822ULL, 0x47E50D68F2493993ULL, 0x00000000177B4845ULL}, // 125
+    {0xE15B0600BDDEE9E3ULL, 0x5391394103D0B78EULL, 0x00000000CC6F83ADULL}, // 126
+    {0x5E2EA3BD208FF820ULL, 0x9C3F76507EE62308ULL, 0x0000000006990EB0ULL}, // 127
+    {0x8F181D3BA7B09EAFULL, 0xEF4FD78AE7054F32ULL, 0x00000000D4042B25ULL}, // 128
+    {0xA586E4E32BC14754ULL, 0x3C9BC6DA33ECB66DULL, 0x00000000EC5400DDULL}, // 129
+    {0x58D1DD50C9E67135ULL, 0x730661737A06F1D5ULL, 0x0000000001A0466BULL}, // 130
+    {0x8583E4C916B5474CULL, 0x0D2098808CD86A60ULL, 0x000000004BE74AD3ULL}, // 131
+    {0x35669E126E396569ULL, 0xDDC23ED9524678B1ULL, 0x00000000CF807DCDULL}, // 132
+    {0x68153E2BDC7B8935ULL, 0xD76B1DCFF6636DA8ULL, 0x000000004C287D93ULL}, // 133
+    {0x5459EA7E73C9E286ULL, 0x0CD2F79FC7223A0CULL, 0x00000000A59CFDFFULL}, // 134
+    {0x28C08D912F0D1697ULL, 0x3F61D0F29027CEACULL, 0x0000000021306449ULL}, // 135
+    {0x1ADC7B1E1719C8E6ULL, 0xF4B88C8EA3C2BD04ULL, 0x0000000095CBED2DULL}, // 136
+    {0x944F34409CC1B72BULL, 0x0AFEDC4CC5526F43ULL, 0x000000005F699EDDULL}, // 137
+    {0x6611C61A011D2B09ULL, 0x5B0F67903DC75B2DULL, 0x0000000029D78D84ULL}, // 138
+    {0x80219909025AB0DEULL, 0x3E41B63A841A448CULL, 0x000000006AEBC460ULL}, // 139
+    {0xB8BC4A5CC0F33D8AULL, 0x4C7C8F6FD1924B68ULL, 0x0000000020260C26ULL}, // 140
+    {0x4E528F6BE8FAD2CEULL, 0xDE30B76D8210D624ULL, 0x000000007E1C2635ULL}, // 141
+    {0xC2DC84A79092F1E2ULL, 0x7E9CD5439CD10E72ULL, 0x00000000DC7EC102ULL}, // 142
+    {0xF16FDBB08EB5997FULL, 0xF579464CB50AD30CULL, 0x00000000FFFC375AULL}, // 143
+    {0x6153F6B0E5D0C10AULL, 0x97D5B06BF8495718ULL, 0x00000000A1526B3DULL}, // 144
+    {0x46E139F91EF40D12ULL, 0x35EF5C35C423A7D9ULL, 0x000000005EFB97FCULL}, // 145
+    {0x7C7AC71F6254E48AULL, 0xCE491FDACDE8561CULL, 0x00000000A26895F8ULL}, // 146
+    {0x62B723D57D41CB11ULL, 0x1D4EEC8E78419246ULL, 0x00000000DDD80CADULL}, // 147
+    {0x7F2834693BADA1D4ULL, 0x0A5F7BD6507073CCULL, 0x000000006ECAD574ULL}, // 148
+    {0xC3E512FAEF3CD1D9ULL, 0xD56274FDAABCCD3AULL, 0x00000000B9365DC6ULL}, // 149
+    {0xDD90692F3F75ED0CULL, 0xBBEAEB3EC06318DDULL, 0x0000000050A5AD48ULL}, // 150
+    {0x0A6ABBF4A8C1D91DULL, 0x0BE9703031726AB5ULL, 0x000000001FB90C7DULL}, // 151
+    {0x8E6E538E53164202ULL, 0x19726A060F024D7DULL, 0x00000000C325A712ULL}, // 152
+    {0x26B26E31703109E7ULL, 0xE0A78431942E6001ULL, 0x00000000B62ED761ULL}, // 153
+    {0x44A3EE2F03E91747ULL, 0xD7391C19A6ACBB1FULL, 0x000000006881BBAEULL}, // 154
+    {0x7C6A064958096CC9ULL, 0x758A3E34E7BAE343ULL, 0x0000000089E81CB9ULL}, // 155
+    {0x4F36BD739CEE9187ULL, 0xAC600B73E204F68BULL, 0x000000003AF18598ULL}, // 156
+    {0xA6F6692AB755D1C1ULL, 0xA50D8EE39B548A4CULL, 0x000000009DF6F295ULL}, // 157
+    {0x18E0F1BB58F107EEULL, 0x515D09DC8A72AEF2ULL, 0x00000000812FC905ULL}, // 158
+    {0x42B66D589BDB4BBDULL, 0x933C075B6B912C6CULL, 0x0000000059FD7C91ULL}  // 159
+};
+
+// x^(2^k) mod P for the XORSHIFT part of kiss32, k = 0 ... 31
+static const uint32_t kiss32JumpPoly[32] = {
+    0x00000002U, 0x00000004U, 0x00000010U, 0x00000100U,
+    0x00010000U, 0x01F05D05U, 0x7F5B22D5U, 0x8EF894B3U,
+    0xDEA37A8EU, 0x97898338U, 0x07D45FE1U, 0x1B7E3E0AU,
+    0x9E6A71BBU, 0xAF5C3B7EU, 0x4F54C193U, 0x6BC10635U,
+    0x4AEF7313U, 0xB3914493U, 0x06030B0FU, 0xB9F536C0U,
+    0x9A446DBCU, 0x9784EA24U, 0x717792A4U, 0xB7D4FF77U,
+    0xD4CB9A79U, 0x29D8308BU, 0xF224692EU, 0x75C1AD51U,
+    0x44A88FE0U, 0x34E87B7AU, 0xB28B4C33U, 0x85A7C96BU
+};
+
+
+uint32_t xorshift32jump(uint32_t *seeds, uint32_t k) {
+    const uint64_t *r = xorshift32JumpPoly[k % 160];
+    uint32_t acc[5] = {0, 0, 0, 0, 0};
+    uint32_t i, w, f;
+
+    // sum of j_i * T^i applied to the state
+    for(i = 0; i < 160; i++) {
+        if((r[i >> 6] >> (i & 63)) & 1) {
+            for(w = 0; w < 5; w++) {
+                acc[w] ^= seeds[w];
+            }
+        }
+        xorshift32(seeds, &f);
+    }
 
-    _err = unifrnd32(u, seeds, &f);
+    for(w = 0; w < 5; w++) {
+        seeds[w] = acc[w];
+    }
 
-    // scaling
-    *sample = a + (b - a) * f;
+    return(0);
+}
 
-    return(_err);
+
+uint32_t kiss32jump(uint32_t *seeds, uint32_t k) {
+    uint32_t r = kiss32JumpPoly[k % 32];
+    uint32_t y = seeds[1], acc = 0, i;
+
+    // number of steps modulo 2^32
+    uint32_t n = (k < 32) ? (1U << k) : 0;
+
+    // XORSHIFT part
+    for(i = 0; i < 32; i++) {
+        if((r >> i) & 1) {
+            acc ^= y;
+        }
+        y ^= (y << 5);
+        y ^= (y >> 7);
+        y ^= (y << 22);
+    }
+    seeds[1] = acc;
+
+    // Weyl sequence
+    seeds[0] += 1411392427U * n;
+
+    // after the first step seeds[2] = seeds[3] and seeds[4] grows by
+    // 2 * seeds[3] modulo 2^31 in every step
+    seeds[4] = (seeds[2] + seeds[3] + seeds[4] + (n - 1) * 2 * seeds[3]) & 2147483647;
+    seeds[2] = seeds[3];
+
+    return(0);
 }
 
 
-// 64-bit uniform random sample on (a, b]
-uint32_t unifrndint64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, double *sample, double a, double b) {
-    uint32_t _err = 0;   
-    double f = 0.0f;
+/*
+ * Streams and substreams.
+ *
+ * Stream i starts i * 2^STREAM steps after stream 0, substream j of
+ * stream i another j * 2^SUBSTREAM steps later. The offset is reached
+ * by one jump of 2^(STREAM + b) for every bit b set in i, the same for
+ * the substream, so the largest jump stays within the tables above.
+ * The KISS output repeats after 2^32 (2^32 - 1) steps, which limits
+ * the number of its streams.
+ */
+#define XORSHIFT32_STREAM 100
+#define XORSHIFT32_STREAMS 60
+#define XORSHIFT32_SUBSTREAM 60
+#define XORSHIFT32_SUBSTREAMS 40
 
-    // check b > a
-    if(a <= b) return(TINYRNG_INTERVAL_ERROR);
+#define KISS32_STREAM 40
+#define KISS32_STREAMS 23
+#define KISS32_SUBSTREAM 20
+#define KISS32_SUBSTREAMS 20
 
-    _err = unifrnd64(u, seeds, &f);
 
-    // scaling
-    *sample = a + (b - a) * f;
+uint32_t streaminit(rngstreams *s, uint32_t generator, uint64_t master) {
+    uint32_t _err = 0;
+
+    if(generator == TINYRNG_XORSHIFT32) {
+        _err = seedfrom(s->base, 5, master);
+    } else if(generator == TINYRNG_KISS32) {
+        _err = seedkissfrom(s->base, master);
+    } else {
+        return(TINYRNG_INTERVAL_ERROR);
+    }
+
+    s->generator = generator;
+    s->next = 0;
 
     return(_err);
 }
 
 
-// 32-bit exponential random sample with mean lambda
-uint32_t exprnd32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, float *sample, float lambda) {
+// seeds = base jumped by j * 2^sub, bits of j above the limit are an error
+static uint32_t streamJump(uint32_t generator, uint32_t *seeds, uint64_t j, uint32_t sub, uint32_t bits) {
+    uint32_t b;
+
+    if(bits < 64 && (j >> bits) != 0) {
+        return(TINYRNG_INTERVAL_ERROR);
+    }
+
+    for(b = 0; j != 0; b++, j >>= 1) {
+        if(j & 1) {
+            if(generator == TINYRNG_XORSHIFT32) {
+                xorshift32jump(seeds, sub + b);
+            } else {
+                kiss32jump(seeds, sub + b);
+            }
+        }
+    }
+
+    return(0);
+}
+
+
+uint32_t substreamget(rngstreams *s, uint64_t i, uint64_t j, uint32_t *seeds) {
     uint32_t _err = 0;
-    float f = 0.0f;
+    uint32_t w;
 
-    _err = unifrnd32(u, seeds, &f);
+    for(w = 0; w < 5; w++) {
+        seeds[w] = s->base[w];
+    }
 
-    *sample = -logf(f) / lambda;
+    if(s->generator == TINYRNG_XORSHIFT32) {
+        _err = streamJump(s->generator, seeds, i, XORSHIFT32_STREAM, XORSHIFT32_STREAMS);
+        if(_err) return(_err);
+        _err = streamJump(s->generator, seeds, j, XORSHIFT32_SUBSTREAM, XORSHIFT32_SUBSTREAMS);
+    } else {
+        _err = streamJump(s->generator, seeds, i, KISS32_STREAM, KISS32_STREAMS);
+        if(_err) return(_err);
+        _err = streamJump(s->generator, seeds, j, KISS32_SUBSTREAM, KISS32_SUBSTREAMS);
+    }
 
     return(_err);
 }
 
-// 64-bit exponential random sample with mean lambda
-uint32_t exprnd64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, double *sample, double lambda) {
+
+uint32_t streamget(rngstreams *s, uint64_t i, uint32_t *seeds) {
+    return(substreamget(s, i, 0, seeds));
+}
+
+
+uint32_t streamnext(rngstreams *s, uint32_t *seeds) {
+    uint64_t i = __atomic_fetch_add(&s->next, 1, __ATOMIC_RELAXED);
+
+    return(substreamget(s, i, 0, seeds));
+}
+
+// -----------------
+// transformations
+// -----------------
+
+
+// bulk uniform samples on (0, 1]
+// the raw words are generated in chunks of UNIF_CHUNK into a local
+// buffer, a multiple of TINYRNG_VEC_LANES so xorshift32vecfill gives
+// the same stream as a single call, and converted as in unifrnd32
+#define UNIF_CHUNK 1024
+
+uint32_t unifrnd32fill(uint32_t (*un)(uint32_t *, uint32_t *, uint32_t), uint32_t *seeds, float *samples, uint32_t n) {
     uint32_t _err = 0;
-    double f = 0.0;
+    uint32_t w[UNIF_CHUNK];
+    uint32_t j, m;
+    union { uint32_t i; float f; } f2;
+
+    for(; n > 0; n -= m, samples += m) {
+        m = n < UNIF_CHUNK ? n : UNIF_CHUNK;
+        _err |= un(seeds, w, m);
+        for(j = 0; j < m; j++) {
+            f2.i = (w[j] >> 9) | 0x3F800000;
+            samples[j] = f2.f - 1.0f;
+        }
+    }
 
-    _err = unifrnd64(u, seeds, &f);
+    return(_err);
+}
 
-    *sample = -log(f) / lambda;
+
+// same for doubles
+uint32_t unifrnd64fill(uint32_t (*un)(uint32_t *, uint64_t *, uint32_t), uint32_t *seeds, double *samples, uint32_t n) {
+    uint32_t _err = 0;
+    uint64_t w[UNIF_CHUNK];
+    uint32_t j, m;
+    union { uint64_t i; double f; } f2;
+
+    for(; n > 0; n -= m, samples += m) {
+        m = n < UNIF_CHUNK ? n : UNIF_CHUNK;
+        _err |= un(seeds, w, m);
+        for(j = 0; j < m; j++) {
+            f2.i = (w[j] >> 12) | 0x3FF0000000000000ULL;
+            samples[j] = f2.f - 1.0;
+        }
+    }
 
     return(_err);
 }
 
 
-// standard normal random sample
-// u2 to make the function re-entrant (thread safe)
-uint32_t normstdrnd32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, float *sample, float *u2) {
+// 32-bit uniform random sample on (a, b]
+uint32_t unifrndint32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, float *sample, float a, float b) {
     uint32_t _err = 0;
-    float r = 0.0f, phi = 0.0f, *ftmp;
+    float f = 0.0f;
 
-    if(isnan(*u2)) {
-        _err = unifrnd32(u, seeds, &r);
-        r = sqrtf(-2.0f * logf(r));
-        _err = unifrnd32(u, seeds, &phi);
-        phi *= TWOPI32;
+    // check b > a
+    if(!(b > a)) return(TINYRNG_INTERVAL_ERROR);
+
+    _err = unifrnd32(u, seeds, &f);
+
+    // scaling
+    *sample = a + (b - a) * f;
 
-        *sample = r * cosf(phi);
-        *u2 = r * sinf(phi);
-    } else { 
-        *sample = *u2;
-        *u2 = NAN;
-    }
-    
     return(_err);
 }
 
 
-// 64-bit standard normal random sample
-// u2 to make the function re-entrant (thread safe)
-uint32_t normstdrnd64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, double *sample, double *u2) {
-    uint32_t _err = 0;
-    double r = 0.0f, phi = 0.0f;
-      
-    if(isnan(*u2)) {
-        _err = unifrnd64(u, seeds, &r);
-        r = sqrt(-2.0f * log(r));
-        _err = unifrnd64(u, seeds, &phi);
-        phi *= TWOPI64;
-
-        *sample = r * cos(phi);
-        *u2 = r * sin(phi);
-    } else {
-        *sample = *u2;
-        *u2 = NAN;
-    }
-    
+// 64-bit uniform random sample on (a, b]
+uint32_t unifrndint64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, double *sample, double a, double b) {
+    uint32_t _err = 0;   
+    double f = 0.0f;
+
+    // check b > a
+    if(!(b > a)) return(TINYRNG_INTERVAL_ERROR);
+
+    _err = unifrnd64(u, seeds, &f);
+
+    // scaling
+    *sample = a + (b - a) * f;
+
     return(_err);
 }
 
@@ -320,7 +876,7 @@ uint32_t normrnd32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, float
     uint32_t _err = 0;
     float f = 0.0f;
 
-    _err = normstdrnd32(u, seeds, &f, u2);
+    _err = NORMSTD32(u, seeds, &f, u2);
   
     *sample = mu + sigma * f;
     
@@ -331,7 +887,7 @@ uint32_t normrnd64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, doubl
     uint32_t _err = 0;
     double f = 0.0f;
 
-    _err = normstdrnd64(u, seeds, &f, u2);
+    _err = NORMSTD64(u, seeds, &f, u2);
   
     *sample = mu + sigma * f;
     
@@ -359,7 +915,7 @@ uint32_t gammarnd32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, floa
     c = 0.33333333333333f / sqrtf(d);
 
     do {
-        _err = normstdrnd32(u, seeds, &x, u2);
+        _err = NORMSTD32(u, seeds, &x, u2);
         v = 1.0f + c * x;
         v = v * v * v;
 
@@ -384,7 +940,7 @@ uint32_t gammarnd64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, doub
     c = 0.33333333333333 / sqrt(d);
 
     do {
-        _err = normstdrnd64(u, seeds, &x, u2);
+        _err = NORMSTD64(u, seeds, &x, u2);
         v = 1.0 + c * x;
         v = v * v * v;
 
@@ -396,6 +952,197 @@ uint32_t gammarnd64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, doub
 }
 
 
+/************************************************************
+ * Bernoulli random bits, 32 or 64 trials side by side
+ ***********************************************************/
+
+/*
+ * Bit i of the result is 1 if U_i < p, where U_i = 0.r1_i r2_i ... is
+ * built from bit i of the generator words r1, r2, ... The bits of p
+ * are compared from the most significant one on, a lane is settled at
+ * the first bit where U_i and p differ. Every step halves the lanes
+ * still open, so the loop ends after about log2(lanes) + 2 steps, or
+ * once the remaining bits of p are all zero. With n < 32 lanes a word
+ * is cut into 32 / n steps of n bits. p is resolved to 2^-32 (2^-64
+ * for the 64-bit version).
+ */
+#define BERNOULLI_CHUNK 256
+
+// p as a binary fraction, p >= 1 is flagged by *all
+static uint32_t bernoulliFraction32(double p, uint32_t *all) {
+    *all = (p >= 1.0);
+    return((p > 0.0 && p < 1.0) ? (uint32_t)(p * 4294967296.0) : 0);
+}
+
+
+static uint64_t bernoulliFraction64(double p, uint32_t *all) {
+    *all = (p >= 1.0);
+    return((p > 0.0 && p < 1.0) ? (uint64_t)(p * 18446744073709551616.0) : 0);
+}
+
+
+// n <= 32 Bernoulli(P / 2^32) bits, a word serves 32 / n steps of n bits
+static uint32_t bernoulliLanes32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, uint32_t P, uint32_t n, uint32_t *bits) {
+    uint32_t _err = 0;
+    uint32_t live = (n < 32) ? (1U << n) - 1 : 0xFFFFFFFFU;
+    uint32_t r = 0, b = 0, res = 0, left = 0;
+
+    while(live != 0 && P != 0) {
+        if(left < n) {
+            _err = u(seeds, &r);
+            left = 32;
+        }
+        // b is all ones where the bit of p is 1: U < p if its bit is 0
+        b = 0U - (P >> 31);
+        res |= live & ~r & b;
+        live &= ~(r ^ b);
+        P <<= 1;
+        // n = 32 uses up the word, the shift by 0 is harmless
+        r >>= n & 31;
+        left -= n;
+    }
+    *bits = res;
+
+    return(_err);
+}
+
+
+static uint32_t bernoulliLanes64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, uint64_t P, uint32_t n, uint64_t *bits) {
+    uint32_t _err = 0;
+    uint64_t live = (n < 64) ? (1ULL << n) - 1 : 0xFFFFFFFFFFFFFFFFULL;
+    uint64_t r = 0, b = 0, res = 0;
+    uint32_t left = 0;
+
+    while(live != 0 && P != 0) {
+        if(left < n) {
+            _err = u(seeds, &r);
+            left = 64;
+        }
+        b = 0ULL - (P >> 63);
+        res |= live & ~r & b;
+        live &= ~(r ^ b);
+        P <<= 1;
+        r >>= n & 63;
+        left -= n;
+    }
+    *bits = res;
+
+    return(_err);
+}
+
+
+static uint32_t popcount64(uint64_t x) {
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+
+    return((uint32_t)((x * 0x0101010101010101ULL) >> 56));
+}
+
+
+uint32_t bernoullirnd32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, uint32_t *bits, float p) {
+    uint32_t all = 0, P = 0;
+
+    if(!(p >= 0.0f && p <= 1.0f)) return(TINYRNG_INTERVAL_ERROR);
+
+    P = bernoulliFraction32(p, &all);
+    if(all) {
+        *bits = 0xFFFFFFFFU;
+        return(TINYRNG_OK);
+    }
+
+    return(bernoulliLanes32(u, seeds, P, 32, bits));
+}
+
+
+uint32_t bernoullirnd64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, uint64_t *bits, double p) {
+    uint32_t all = 0;
+    uint64_t P = 0;
+
+    if(!(p >= 0.0 && p <= 1.0)) return(TINYRNG_INTERVAL_ERROR);
+
+    P = bernoulliFraction64(p, &all);
+    if(all) {
+        *bits = 0xFFFFFFFFFFFFFFFFULL;
+        return(TINYRNG_OK);
+    }
+
+    return(bernoulliLanes64(u, seeds, P, 64, bits));
+}
+
+
+/*
+ * Bulk versions, the words are drawn in chunks from un and used as in
+ * bernoulliLanes32 / bernoulliLanes64. Words left over in the last
+ * chunk are dropped.
+ */
+uint32_t bernoullifill32(uint32_t (*un)(uint32_t *, uint32_t *, uint32_t), uint32_t *seeds, uint32_t *mask, uint32_t n, float p) {
+    uint32_t _err = 0;
+    uint32_t buf[BERNOULLI_CHUNK];
+    uint32_t all = 0, P = 0, Q = 0, live = 0, r = 0, b = 0, res = 0;
+    uint32_t i, words = (n + 31) / 32, used = BERNOULLI_CHUNK;
+
+    if(!(p >= 0.0f && p <= 1.0f)) return(TINYRNG_INTERVAL_ERROR);
+
+    P = bernoulliFraction32(p, &all);
+    for(i = 0; i < words && _err == 0; i++) {
+        live = 0xFFFFFFFFU;
+        res = all ? live : 0;
+        for(Q = P; live != 0 && Q != 0; Q <<= 1) {
+            if(used == BERNOULLI_CHUNK) {
+                _err = un(seeds, buf, BERNOULLI_CHUNK);
+                used = 0;
+            }
+            r = buf[used++];
+            b = 0U - (Q >> 31);
+            res |= live & ~r & b;
+            live &= ~(r ^ b);
+        }
+        mask[i] = res;
+    }
+
+    // clear the bits beyond n
+    if(n & 31) {
+        mask[words - 1] &= (1U << (n & 31)) - 1;
+    }
+
+    return(_err);
+}
+
+
+uint32_t bernoullifill64(uint32_t (*un)(uint32_t *, uint64_t *, uint32_t), uint32_t *seeds, uint64_t *mask, uint32_t n, double p) {
+    uint32_t _err = 0;
+    uint64_t buf[BERNOULLI_CHUNK];
+    uint64_t P = 0, Q = 0, live = 0, r = 0, b = 0, res = 0;
+    uint32_t all = 0, i, words = (uint32_t)(((uint64_t)n + 63) / 64), used = BERNOULLI_CHUNK;
+
+    if(!(p >= 0.0 && p <= 1.0)) return(TINYRNG_INTERVAL_ERROR);
+
+    P = bernoulliFraction64(p, &all);
+    for(i = 0; i < words && _err == 0; i++) {
+        live = 0xFFFFFFFFFFFFFFFFULL;
+        res = all ? live : 0;
+        for(Q = P; live != 0 && Q != 0; Q <<= 1) {
+            if(used == BERNOULLI_CHUNK) {
+                _err = un(seeds, buf, BERNOULLI_CHUNK);
+                used = 0;
+            }
+            r = buf[used++];
+            b = 0ULL - (Q >> 63);
+            res |= live & ~r & b;
+            live &= ~(r ^ b);
+        }
+        mask[i] = res;
+    }
+
+    if(n & 63) {
+        mask[words - 1] &= (1ULL << (n & 63)) - 1;
+    }
+
+    return(_err);
+}
+
+
 /*****************************************************************
  * binomial random sample with number of trail n and probability p
  ****************************************************************/
@@ -406,8 +1153,9 @@ uint32_t geometricMethod32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seed
     float x = -1.0f;
     float y = 0.0f;
 
+    // p == 0, no trial succeeds
     if(c == 0.0f) {
-        *sample = 0.0f;
+        x = 0.0f;
     } else {
         do {
             _err = unifrnd32(u, seeds, &_f);
@@ -428,8 +1176,9 @@ uint32_t geometricMethod64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seed
     double x = -1.0f;
     double y = 0.0f;
 
+    // p == 0, no trial succeeds
     if(c == 0.0f) {
-        *sample = 0.0f;
+        x = 0.0f;
     } else {
         do {
             _err = unifrnd64(u, seeds, &_f);
@@ -443,23 +1192,162 @@ uint32_t geometricMethod64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seed
 }
 
 
+/*
+ * BTPE, Kachitvichyanukul & Schmeiser (1988), for n * p >= 30 and p <= 0.5.
+ * The region set-up is kept in an rngdist so that distrnd can reuse it.
+ * Set-up and acceptance test are carried out in double precision for both
+ * variants, float cannot resolve the mode for large n.
+ */
+static void btpeSetup(rngdist *d, double n, double p) {
+    double fm = n * p + p, a = 0.0;
+
+    d->par.btpe.n = n;
+    d->par.btpe.r = p;
+    d->par.btpe.q = 1.0 - p;
+    d->par.btpe.nrq = n * p * (1.0 - p);
+    d->par.btpe.s = p / (1.0 - p);
+    d->par.btpe.a = d->par.btpe.s * (n + 1.0);
+    d->par.btpe.m = floor(fm);
+    d->par.btpe.xm = d->par.btpe.m + 0.5;
+    d->par.btpe.p1 = floor(2.195 * sqrt(d->par.btpe.nrq) - 4.6 * d->par.btpe.q) + 0.5;
+    d->par.btpe.xl = d->par.btpe.xm - d->par.btpe.p1;
+    d->par.btpe.xr = d->par.btpe.xm + d->par.btpe.p1;
+    d->par.btpe.c = 0.134 + 20.5 / (15.3 + d->par.btpe.m);
+
+    a = (fm - d->par.btpe.xl) / (fm - d->par.btpe.xl * p);
+    d->par.btpe.laml = a * (1.0 + 0.5 * a);
+    a = (d->par.btpe.xr - fm) / (d->par.btpe.xr * d->par.btpe.q);
+    d->par.btpe.lamr = a * (1.0 + 0.5 * a);
+    d->par.btpe.p2 = d->par.btpe.p1 * (1.0 + 2.0 * d->par.btpe.c);
+    d->par.btpe.p3 = d->par.btpe.p2 + d->par.btpe.c / d->par.btpe.laml;
+    d->par.btpe.p4 = d->par.btpe.p3 + d->par.btpe.c / d->par.btpe.lamr;
+}
+
+
+// one trial with the uniforms u1, u2, returns 1 and the sample y on acceptance
+static uint32_t btpeTrial(const rngdist *d, double u1, double u2, double *y) {
+    double n = d->par.btpe.n, r = d->par.btpe.r, q = d->par.btpe.q, nrq = d->par.btpe.nrq;
+    double m = d->par.btpe.m, xm = d->par.btpe.xm, p1 = d->par.btpe.p1, c = d->par.btpe.c;
+    double uu = u1 * d->par.btpe.p4, v = u2;
+    double x = 0.0, k = 0.0, F = 0.0, i = 0.0;
+    double rho = 0.0, t = 0.0, A = 0.0, x1 = 0.0, f1 = 0.0, z = 0.0, w = 0.0;
+    double x2 = 0.0, f2 = 0.0, z2 = 0.0, w2 = 0.0;
+
+    // triangular region, immediate acceptance
+    if(uu <= p1) {
+        *y = floor(xm - p1 * v + uu);
+        return(1);
+    }
+
+    if(uu <= d->par.btpe.p2) {
+        // parallelograms
+        x = d->par.btpe.xl + (uu - p1) / c;
+        v = v * c + 1.0 - fabs(m - x + 0.5) / p1;
+        if(v > 1.0) return(0);
+        *y = floor(x);
+    } else if(uu <= d->par.btpe.p3) {
+        // left exponential tail
+        *y = floor(d->par.btpe.xl + log(v) / d->par.btpe.laml);
+        if(*y < 0.0) return(0);
+        v = v * (uu - d->par.btpe.p2) * d->par.btpe.laml;
+    } else {
+        // right exponential tail
+        *y = floor(d->par.btpe.xr - log(v) / d->par.btpe.lamr);
+        if(*y > n) return(0);
+        v = v * (uu - d->par.btpe.p3) * d->par.btpe.lamr;
+    }
+
+    k = fabs(*y - m);
+    if(k <= 20.0 || k >= 0.5 * nrq - 1.0) {
+        // explicit evaluation of f(y) / f(m) by recursion
+        F = 1.0;
+        if(m < *y) {
+            for(i = m + 1.0; i <= *y; i++) F *= (d->par.btpe.a / i - d->par.btpe.s);
+        } else if(m > *y) {
+            for(i = *y + 1.0; i <= m; i++) F /= (d->par.btpe.a / i - d->par.btpe.s);
+        }
+        return(v <= F);
+    }
+
+    // squeeze on log(v) using the normal approximation
+    rho = (k / nrq) * ((k * (k / 3.0 + 0.625) + 0.1666666666666) / nrq + 0.5);
+    t = -k * k / (2.0 * nrq);
+    A = log(v);
+    if(A < t - rho) return(1);
+    if(A > t + rho) return(0);
+
+    // final test, Stirling's formula for the four factorials
+    x1 = *y + 1.0;
+    f1 = m + 1.0;
+    z = n + 1.0 - m;
+    w = n - *y + 1.0;
+    x2 = x1 * x1;
+    f2 = f1 * f1;
+    z2 = z * z;
+    w2 = w * w;
+    return(A <= xm * log(f1 / x1) + (n - m + 0.5) * log(z / w) + (*y - m) * log(w * r / (x1 * q))
+            + (13680.0 - (462.0 - (132.0 - (99.0 - 140.0 / f2) / f2) / f2) / f2) / f1 / 166320.0
+            + (13680.0 - (462.0 - (132.0 - (99.0 - 140.0 / z2) / z2) / z2) / z2) / z / 166320.0
+            + (13680.0 - (462.0 - (132.0 - (99.0 - 140.0 / x2) / x2) / x2) / x2) / x1 / 166320.0
+            + (13680.0 - (462.0 - (132.0 - (99.0 - 140.0 / w2) / w2) / w2) / w2) / w / 166320.0);
+}
+
+
+uint32_t btpe32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, int32_t *sample, uint32_t n, float p) {
+    uint32_t _err = 0;
+    float _f1 = 0.0f, _f2 = 0.0f;
+    double y = 0.0;
+    rngdist d;
+
+    btpeSetup(&d, n, p);
+    do {
+        _err = unifrnd32(u, seeds, &_f1);
+        _err = unifrnd32(u, seeds, &_f2);
+    } while(!btpeTrial(&d, _f1, _f2, &y));
+    *sample = (int32_t)y;
+
+    return(_err);
+}
+
+
+uint32_t btpe64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, int64_t *sample, uint64_t n, double p) {
+    uint32_t _err = 0;
+    double _f1 = 0.0, _f2 = 0.0;
+    double y = 0.0;
+    rngdist d;
+
+    btpeSetup(&d, n, p);
+    do {
+        _err = unifrnd64(u, seeds, &_f1);
+        _err = unifrnd64(u, seeds, &_f2);
+    } while(!btpeTrial(&d, _f1, _f2, &y));
+    *sample = (int64_t)y;
+
+    return(_err);
+}
+
+
 uint32_t binomialrnd32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, int32_t *sample, float *u2, uint32_t n, float p) {
     uint32_t _err = 0;
-    uint32_t i = 0;
-    float _ftmp = 0.0f;
+    uint32_t all = 0, P = 0, bits = 0;
+    float pp = (p > 0.5f) ? 1.0f - p : p;
     int32_t f = 0.0f;
     
     if (n < 10) {
-        for (i = 0; i < n; i++) {
-            _err = unifrnd32(u, seeds, &_ftmp);
-            f += (_ftmp < p);
-        }
-    } else  if (n < 200.0f || n * p < 70.0f) {
-        _err = geometricMethod32(u, seeds, &f, n, p);
+        // the n trials side by side, one bit each
+        P = bernoulliFraction32(p, &all);
+        _err = bernoulliLanes32(u, seeds, P, n, &bits);
+        f = all ? n : popcount64(bits);
     } else {
-        // approximate the binomial distribution with the normal distribution
-        _err = normrnd32(u, seeds, &_ftmp, u2, n * p, sqrtf(n * p * (1 - p)));
-        f = (int32_t)floorf(_ftmp);
+        // sample the count of the less likely outcome
+        if (n * pp < 30.0f) {
+            _err = geometricMethod32(u, seeds, &f, n, pp);
+        } else {
+            _err = btpe32(u, seeds, &f, n, pp);
+        }
+        if (pp != p) {
+            f = n - f;
+        }
     }
     *sample = f;
 
@@ -469,21 +1357,26 @@ uint32_t binomialrnd32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, i
 
 uint32_t binomialrnd64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, int64_t *sample, double *u2, uint64_t n, double p) {
     uint32_t _err = 0;
-    uint32_t i = 0;
-    double _ftmp = 0.0f;
+    uint32_t all = 0;
+    uint64_t P = 0, bits = 0;
+    double pp = (p > 0.5) ? 1.0 - p : p;
     int64_t f = 0.0f;
     
     if (n < 10) {
-        for (i = 0; i < n; i++) {
-            _err = unifrnd64(u, seeds, &_ftmp);
-            f += (_ftmp < p);
-        }
-    } else  if (n < 200.0f || n * p < 70.0f) {
-        _err = geometricMethod64(u, seeds, &f, n, p);
+        // the n trials side by side, one bit each
+        P = bernoulliFraction64(p, &all);
+        _err = bernoulliLanes64(u, seeds, P, (uint32_t)n, &bits);
+        f = all ? n : popcount64(bits);
     } else {
-        // approximate the binomial distribution with the normal distribution
-        _err = normrnd64(u, seeds, &_ftmp, u2, n * p, sqrtf(n * p * (1 - p)));
-        f = (int64_t)floor(_ftmp);
+        // sample the count of the less likely outcome
+        if (n * pp < 30.0) {
+            _err = geometricMethod64(u, seeds, &f, n, pp);
+        } else {
+            _err = btpe64(u, seeds, &f, n, pp);
+        }
+        if (pp != p) {
+            f = n - f;
+        }
     }
     *sample = f;
 
@@ -496,293 +1389,303 @@ uint32_t binomialrnd64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, i
  **************************************************/
 
 /*
- * re-write of the log factorial code
+ * log(N!) for N = 0, ..., LOGFACTORIAL_TABLE - 1, computed to 50 digits
+ * and rounded to double. Beyond the table the Stirling series
+ *   log(N!) = (N + 1/2) log(N) - N + log(2 PI) / 2
+ *             + 1/(12 N) - 1/(360 N^3) + 1/(1260 N^5)
+ * is accurate to double precision, the next term is below 1e-24.
  */
-float logFactorial32(float N) {
-    float f = 0.0f;
+#define LOGFACTORIAL_TABLE 1024
+
+static const double logFactorialTable[LOGFACTORIAL_TABLE] = {
+    0.00000000000000000e+00, 0.00000000000000000e+00, 6.93147180559945286e-01, 1.79175946922805496e+00,
+    3.17805383034794575e+00, 4.78749174278204581e+00, 6.57925121201010121e+00, 8.52516136106541467e+00,
+    1.06046029027452509e+01, 1.28018274800814691e+01, 1.51044125730755159e+01, 1.75023078458738865e+01,
+    1.99872144956618847e+01, 2.25521638531234245e+01, 2.51912211827386798e+01, 2.78992713838408903e+01,
+    3.06718601060806719e+01, 3.35050734501368908e+01, 3.63954452080330526e+01, 3.93398841871994946e+01,
+    4.23356164607534851e+01, 4.53801388984769076e+01, 4.84711813518352272e+01, 5.16066755677643769e+01,
+    5.47847293981123187e+01, 5.80036052229805179e+01, 6.12617017610020014e+01, 6.45575386270063376e+01,
+    6.78897431371815401e+01, 7.12570389671680147e+01, 7.46582363488301581e+01, 7.80922235533153071e+01,
+    8.15579594561150429e+01, 8.50544670175815156e+01, 8.85808275421976816e+01, 9.21361756036870929e+01,
+    9.57196945421432019e+01, 9.93306124547874276e+01, 1.02968198614513810e+02, 1.06631760260643460e+02,
+    1.10320639714757391e+02, 1.14034211781461707e+02, 1.17771881399745070e+02, 1.21533081515438639e+02,
+    1.25317271149356898e+02, 1.29123933639127216e+02, 1.32952575035616320e+02, 1.36802722637326355e+02,
+    1.40673923648234251e+02, 1.44565743946344895e+02, 1.48477766951773020e+02, 1.52409592584497346e+02,
+    1.56360836303078798e+02, 1.60331128216630901e+02, 1.64320112263195170e+02, 1.68327445448427653e+02,
+    1.72352797139162789e+02, 1.76395848406997345e+02, 1.80456291417543781e+02, 1.84533828861449479e+02,
+    1.88628173423671598e+02, 1.92739047287844897e+02, 1.96866181672890008e+02, 2.01009316399281516e+02,
+    2.05168199482641199e+02, 2.09342586752536846e+02, 2.13532241494563266e+02, 2.17736934113954220e+02,
+    2.21956441819130333e+02, 2.26190548323727597e+02, 2.30439043565776956e+02, 2.34701723442818263e+02,
+    2.38978389561834319e+02, 2.43268849002982705e+02, 2.47572914096186878e+02, 2.51890402209723192e+02,
+    2.56221135550009535e+02, 2.60564940971863223e+02, 2.64921649798552778e+02, 2.69291097651019811e+02,
+    2.73673124285693689e+02, 2.78067573440366118e+02, 2.82474292687630395e+02, 2.86893133295426992e+02,
+    2.91323950094270288e+02, 2.95766601350760652e+02, 3.00220948647014154e+02, 3.04686856765668722e+02,
+    3.09164193580146900e+02, 3.13652829949879049e+02, 3.18152639620209300e+02, 3.22663499126726151e+02,
+    3.27185287703775202e+02, 3.31717887196928473e+02, 3.36261181979198454e+02, 3.40815058870799021e+02,
+    3.45379407062266864e+02, 3.49954118040770254e+02, 3.54539085519440789e+02, 3.59134205369575398e+02,
+    3.63739375555563470e+02, 3.68354496072404743e+02, 3.72979468885689016e+02, 3.77614197873918670e+02,
+    3.82258588773060012e+02, 3.86912549123217559e+02, 3.91575988217329609e+02, 3.96248817051791548e+02,
+    4.00930948278915764e+02, 4.05622296161144902e+02, 4.10322776526937332e+02, 4.15032306728249637e+02,
+    4.19750805599544719e+02, 4.24478193418257092e+02, 4.29214391866651567e+02, 4.33959323995014813e+02,
+    4.38712914186121168e+02, 4.43475088120918940e+02, 4.48245772745384613e+02, 4.53024896238496126e+02,
+    4.57812387981278164e+02, 4.62608178526874894e+02, 4.67412199571608198e+02, 4.72224383926980579e+02,
+    4.77044665492585636e+02, 4.81872979229887960e+02, 4.86709261136839416e+02, 4.91553448223298005e+02,
+    4.96405478487217636e+02, 5.01265290891579298e+02, 5.06132825342034891e+02, 5.11008022665236012e+02,
+    5.15890824587822408e+02, 5.20781173716044123e+02, 5.25679013515995052e+02, 5.30584288294433463e+02,
+    5.35496943180169524e+02, 5.40416924105997623e+02, 5.45344177791154834e+02, 5.50278651724285510e+02,
+    5.55220294146894844e+02, 5.60169054037272986e+02, 5.65124881094874354e+02, 5.70087725725134192e+02,
+    5.75057539024710195e+02, 5.80034272767130801e+02, 5.85017879388839106e+02, 5.90008311975617858e+02,
+    5.95005524249382006e+02, 6.00009470555327425e+02, 6.05020105849423658e+02, 6.10037385686238622e+02,
+    6.15061266207084941e+02, 6.20091704128477318e+02, 6.25128656730890953e+02, 6.30172081847810205e+02,
+    6.35221937855059764e+02, 6.40278183660407990e+02, 6.45340778693435027e+02, 6.50409682895655237e+02,
+    6.55484856710889062e+02, 6.60566261075873513e+02, 6.65653857411105946e+02, 6.70747607611912713e+02,
+    6.75847474039736881e+02, 6.80953419513637414e+02, 6.86065407301994014e+02, 6.91183401114410799e+02,
+    6.96307365093814042e+02, 7.01437263808737043e+02, 7.06573062245787355e+02, 7.11714725802289990e+02,
+    7.16862220279103440e+02, 7.22015511873601213e+02, 7.27174567172815728e+02, 7.32339353146739313e+02,
+    7.37509837141777439e+02, 7.42685986874351215e+02, 7.47867770424643368e+02, 7.53055156230484158e+02,
+    7.58248113081374299e+02, 7.63446610112640087e+02, 7.68650616799716886e+02, 7.73860102952558350e+02,
+    7.79075038710167291e+02, 7.84295394535245691e+02, 7.89521141208958852e+02, 7.94752249825813465e+02,
+    7.99988691788643450e+02, 8.05230438803703009e+02, 8.10477462875863580e+02, 8.15729736303910158e+02,
+    8.20987231675937892e+02, 8.26249921864842804e+02, 8.31517780023906198e+02, 8.36790779582469895e+02,
+    8.42068894241700377e+02, 8.47352097970438422e+02, 8.52640365001132977e+02, 8.57933669825857464e+02,
+    8.63231987192405427e+02, 8.68535292100464517e+02, 8.73843559797865737e+02, 8.79156765776907491e+02,
+    8.84474885770751712e+02, 8.89797895749890131e+02, 8.95125771918679789e+02, 9.00458490711945160e+02,
+    9.05796028791646449e+02, 9.11138363043611207e+02, 9.16485470574328701e+02, 9.21837328707804772e+02,
+    9.27193914982476826e+02, 9.32555207148186241e+02, 9.37921183163208070e+02, 9.43291821191335771e+02,
+    9.48667099599019934e+02, 9.54046996952560335e+02, 9.59431492015349477e+02, 9.64820563745165941e+02,
+    9.70214191291518318e+02, 9.75612353993036095e+02, 9.81015031374908290e+02, 9.86422203146368474e+02,
+    9.91833849198223447e+02, 9.97249949600427954e+02, 1.00267048459970022e+03, 1.00809543461718158e+03,
+    1.01352478024613606e+03, 1.01895850224969024e+03, 1.02439658155861343e+03, 1.02983899926913523e+03,
+    1.03528573664080159e+03, 1.04073677509436720e+03, 1.04619209620972492e+03, 1.05165168172386916e+03,
+    1.05711551352889478e+03, 1.06258357367002986e+03, 1.06805584434370144e+03, 1.07353230789563281e+03,
+    1.07901294681897480e+03, 1.08449774375246557e+03, 1.08998668147862213e+03, 1.09547974292196272e+03,
+    1.10097691114725603e+03, 1.10647816935780065e+03, 1.11198350089373298e+03, 1.11749288923036102e+03,
+    1.12300631797652591e+03, 1.12852377087299078e+03, 1.13404523179085299e+03, 1.13957068472998481e+03,
+    1.14510011381749609e+03, 1.15063350330622370e+03, 1.15617083757324212e+03, 1.16171210111840060e+03,
+    1.16725727856288017e+03, 1.17280635464777538e+03, 1.17835931423269699e+03, 1.18391614229439665e+03,
+    1.18947682392541219e+03, 1.19504134433273475e+03, 1.20060968883649593e+03, 1.20618184286867358e+03,
+    1.21175779197182010e+03, 1.21733752179780618e+03, 1.22292101810658801e+03, 1.22850826676498809e+03,
+    1.23409925374549903e+03, 1.23969396512510093e+03, 1.24529238708409912e+03, 1.25089450590497904e+03,
+    1.25650030797127488e+03, 1.26210977976645995e+03, 1.26772290787284805e+03, 1.27333967897051457e+03,
+    1.27896007983623167e+03, 1.28458409734241900e+03, 1.29021171845610957e+03, 1.29584293023793111e+03,
+    1.30147771984110022e+03, 1.30711607451043392e+03, 1.31275798158137218e+03, 1.31840342847901547e+03,
+    1.32405240271717662e+03, 1.32970489189744512e+03, 1.33536088370826496e+03, 1.34102036592402465e+03,
+    1.34668332640416065e+03, 1.35234975309227298e+03, 1.35801963401525359e+03, 1.36369295728242514e+03,
+    1.36936971108469334e+03, 1.37504988369371040e+03, 1.38073346346104904e+03, 1.38642043881738891e+03,
+    1.39211079827171307e+03, 1.39780453041051578e+03, 1.40350162389702109e+03, 1.40920206747041175e+03,
+    1.41490584994506798e+03, 1.42061296020981695e+03, 1.42632338722719169e+03, 1.43203712003270107e+03,
+    1.43775414773410739e+03, 1.44347445951071472e+03, 1.44919804461266722e+03, 1.45492489236025426e+03,
+    1.46065499214322790e+03, 1.46638833342012572e+03, 1.47212490571760486e+03, 1.47786469862978402e+03,
+    1.48360770181759358e+03, 1.48935390500813378e+03, 1.49510329799404190e+03, 1.50085587063286766e+03,
+    1.50661161284645459e+03, 1.51237051462033173e+03, 1.51813256600311206e+03, 1.52389775710589674e+03,
+    1.52966607810169057e+03, 1.53543751922482056e+03, 1.54121207077036502e+03, 1.54698972309358760e+03,
+    1.55277046660938004e+03, 1.55855429179170983e+03, 1.56434118917307637e+03, 1.57013114934397368e+03,
+    1.57592416295235785e+03, 1.58172022070312323e+03, 1.58751931335758377e+03, 1.59332143173296072e+03,
+    1.59912656670187721e+03, 1.60493470919185779e+03, 1.61074585018483435e+03, 1.61655998071665954e+03,
+    1.62237709187662267e+03, 1.62819717480697500e+03, 1.63402022070245812e+03, 1.63984622080983854e+03,
+    1.64567516642744863e+03, 1.65150704890473230e+03, 1.65734185964179483e+03, 1.66317959008896082e+03,
+    1.66902023174633428e+03, 1.67486377616336563e+03, 1.68071021493842318e+03, 1.68655953971837016e+03,
+    1.69241174219814457e+03, 1.69826681412034714e+03, 1.70412474727483050e+03, 1.70998553349829626e+03,
+    1.71584916467389439e+03, 1.72171563273082779e+03, 1.72758492964396146e+03, 1.73345704743343686e+03,
+    1.73933197816428901e+03, 1.74520971394606863e+03, 1.75109024693246920e+03, 1.75697356932095749e+03,
+    1.76285967335240775e+03, 1.76874855131074059e+03, 1.77464019552256650e+03, 1.78053459835683134e+03,
+    1.78643175222446803e+03, 1.79233164957805047e+03, 1.79823428291145183e+03, 1.80413964475950638e+03,
+    1.81004772769767533e+03, 1.81595852434171593e+03, 1.82187202734735411e+03, 1.82778822940996156e+03,
+    1.83370712326423472e+03, 1.83962870168387849e+03, 1.84555295748129311e+03, 1.85147988350726359e+03,
+    1.85740947265065347e+03, 1.86334171783810143e+03, 1.86927661203372099e+03, 1.87521414823880332e+03,
+    1.88115431949152389e+03, 1.88709711886665059e+03, 1.89304253947525717e+03, 1.89899057446443771e+03,
+    1.90494121701702556e+03, 1.91089446035131323e+03, 1.91685029772077814e+03, 1.92280872241380780e+03,
+    1.92876972775343120e+03, 1.93473330709704965e+03, 1.94069945383617323e+03, 1.94666816139615867e+03,
+    1.95263942323594915e+03, 1.95861323284781838e+03, 1.96458958375711632e+03, 1.97056846952201749e+03,
+    1.97654988373327183e+03, 1.98253382001395903e+03, 1.98852027201924352e+03, 1.99450923343613340e+03,
+    2.00050069798324148e+03, 2.00649465941054791e+03, 2.01249111149916689e+03, 2.01849004806111361e+03,
+    2.02449146293907484e+03, 2.03049535000618130e+03, 2.03650170316578306e+03, 2.04251051635122576e+03,
+    2.04852178352562987e+03, 2.05453549868167283e+03, 2.06055165584137103e+03, 2.06657024905586741e+03,
+    2.07259127240521684e+03, 2.07861471999817786e+03, 2.08464058597200301e+03, 2.09066886449223375e+03,
+    2.09669954975249493e+03, 2.10273263597429377e+03, 2.10876811740681842e+03, 2.11480598832674059e+03,
+    2.12084624303801820e+03, 2.12688887587170075e+03, 2.13293388118573648e+03, 2.13898125336478279e+03,
+    2.14503098682001473e+03, 2.15108307598893907e+03, 2.15713751533520872e+03, 2.16319429934843720e+03,
+    2.16925342254401903e+03, 2.17531487946294692e+03, 2.18137866467163485e+03, 2.18744477276173848e+03,
+    2.19351319834998230e+03, 2.19958393607798507e+03, 2.20565698061208559e+03, 2.21173232664317402e+03,
+    2.21780996888652317e+03, 2.22388990208161886e+03, 2.22997212099199533e+03, 2.23605662040507013e+03,
+    2.24214339513198274e+03, 2.24823244000742943e+03, 2.25432374988950733e+03, 2.26041731965955250e+03,
+    2.26651314422198448e+03, 2.27261121850415066e+03, 2.27871153745617084e+03, 2.28481409605078443e+03,
+    2.29091888928319941e+03, 2.29702591217094187e+03, 2.30313515975370592e+03, 2.30924662709320864e+03,
+    2.31536030927304091e+03, 2.32147620139852415e+03, 2.32759429859656530e+03, 2.33371459601551624e+03,
+    2.33983708882503061e+03, 2.34596177221592507e+03, 2.35208864140003925e+03, 2.35821769161009979e+03,
+    2.36434891809958253e+03, 2.37048231614257929e+03, 2.37661788103366098e+03, 2.38275560808774753e+03,
+    2.38889549263997378e+03, 2.39503753004556074e+03, 2.40118171567968648e+03, 2.40732804493735557e+03,
+    2.41347651323327318e+03, 2.41962711600171951e+03, 2.42577984869642341e+03, 2.43193470679044003e+03,
+    2.43809168577602532e+03, 2.44425078116451732e+03, 2.45041198848621252e+03, 2.45657530329024712e+03,
+    2.46274072114447836e+03, 2.46890823763536673e+03, 2.47507784836785822e+03, 2.48124954896526924e+03,
+    2.48742333506917112e+03, 2.49359920233927687e+03, 2.49977714645332753e+03, 2.50595716310698026e+03,
+    2.51213924801369694e+03, 2.51832339690463414e+03, 2.52450960552853485e+03, 2.53069786965161757e+03,
+    2.53688818505747031e+03, 2.54308054754694558e+03, 2.54927495293804986e+03, 2.55547139706584449e+03,
+    2.56166987578233693e+03, 2.56787038495637944e+03, 2.57407292047356759e+03, 2.58027747823613618e+03,
+    2.58648405416286096e+03, 2.59269264418895773e+03, 2.59890324426598227e+03, 2.60511585036173392e+03,
+    2.61133045846015602e+03, 2.61754706456124086e+03, 2.62376566468093279e+03, 2.62998625485103230e+03,
+    2.63620883111910371e+03, 2.64243338954837918e+03, 2.64865992621766645e+03, 2.65488843722125785e+03,
+    2.66111891866883616e+03, 2.66735136668538689e+03, 2.67358577741110503e+03, 2.67982214700130908e+03,
+    2.68606047162634832e+03, 2.69230074747151912e+03, 2.69854297073697444e+03, 2.70478713763763790e+03,
+    2.71103324440311962e+03, 2.71728128727762805e+03, 2.72353126251988760e+03, 2.72978316640305320e+03,
+    2.73603699521462886e+03, 2.74229274525638220e+03, 2.74855041284426488e+03, 2.75480999430832981e+03,
+    2.76107148599265065e+03, 2.76733488425524229e+03, 2.77360018546798028e+03, 2.77986738601652178e+03,
+    2.78613648230022773e+03, 2.79240747073208604e+03, 2.79868034773863246e+03, 2.80495510975987418e+03,
+    2.81123175324921567e+03, 2.81751027467338190e+03, 2.82379067051234188e+03, 2.83007293725923773e+03,
+    2.83635707142030878e+03, 2.84264306951481740e+03, 2.84893092807497942e+03, 2.85522064364588823e+03,
+    2.86151221278544654e+03, 2.86780563206429315e+03, 2.87410089806573296e+03, 2.88039800738566692e+03,
+    2.88669695663252287e+03, 2.89299774242718604e+03, 2.89930036140293078e+03, 2.90560481020535281e+03,
+    2.91191108549230103e+03, 2.91821918393381020e+03, 2.92452910221203683e+03, 2.93084083702118960e+03,
+    2.93715438506746705e+03, 2.94346974306898937e+03, 2.94978690775573659e+03, 2.95610587586948304e+03,
+    2.96242664416373373e+03, 2.96874920940366064e+03, 2.97507356836604231e+03, 2.98139971783919736e+03,
+    2.98772765462292637e+03, 2.99405737552844903e+03, 3.00038887737834284e+03, 3.00672215700648258e+03,
+    3.01305721125798073e+03, 3.01939403698912702e+03, 3.02573263106733020e+03, 3.03207299037105804e+03,
+    3.03841511178977908e+03, 3.04475899222390535e+03, 3.05110462858473420e+03, 3.05745201779439003e+03,
+    3.06380115678576976e+03, 3.07015204250248462e+03, 3.07650467189880419e+03, 3.08285904193960141e+03,
+    3.08921514960029754e+03, 3.09557299186680530e+03, 3.10193256573547797e+03, 3.10829386821305070e+03,
+    3.11465689631659143e+03, 3.12102164707344309e+03, 3.12738811752117454e+03, 3.13375630470752503e+03,
+    3.14012620569035334e+03, 3.14649781753758543e+03, 3.15287113732716216e+03, 3.15924616214699017e+03,
+    3.16562288909488916e+03, 3.17200131527854046e+03, 3.17838143781544022e+03, 3.18476325383284620e+03,
+    3.19114676046773047e+03, 3.19753195486672803e+03, 3.20391883418609086e+03, 3.21030739559163658e+03,
+    3.21669763625870155e+03, 3.22308955337209454e+03, 3.22948314412604486e+03, 3.23587840572416053e+03,
+    3.24227533537937643e+03, 3.24867393031391202e+03, 3.25507418775922042e+03, 3.26147610495594790e+03,
+    3.26787967915388253e+03, 3.27428490761191324e+03, 3.28069178759798297e+03, 3.28710031638904229e+03,
+    3.29351049127100850e+03, 3.29992230953871831e+03, 3.30633576849588553e+03, 3.31275086545505746e+03,
+    3.31916759773756939e+03, 3.32558596267350595e+03, 3.33200595760165288e+03, 3.33842757986945935e+03,
+    3.34485082683299288e+03, 3.35127569585689844e+03, 3.35770218431435615e+03, 3.36413028958704081e+03,
+    3.37056000906507961e+03, 3.37699134014701349e+03, 3.38342428023975253e+03, 3.38985882675854009e+03,
+    3.39629497712690954e+03, 3.40273272877664567e+03, 3.40917207914774599e+03, 3.41561302568837891e+03,
+    3.42205556585484692e+03, 3.42849969711154745e+03, 3.43494541693093288e+03, 3.44139272279347415e+03,
+    3.44784161218762119e+03, 3.45429208260976520e+03, 3.46074413156420269e+03, 3.46719775656309503e+03,
+    3.47365295512643524e+03, 3.48010972478200756e+03, 3.48656806306535236e+03, 3.49302796751972983e+03,
+    3.49948943569608355e+03, 3.50595246515300414e+03, 3.51241705345669425e+03, 3.51888319818093169e+03,
+    3.52535089690703626e+03, 3.53182014722383201e+03, 3.53829094672761448e+03, 3.54476329302211525e+03,
+    3.55123718371846780e+03, 3.55771261643517164e+03, 3.56418958879806132e+03, 3.57066809844027011e+03,
+    3.57714814300219678e+03, 3.58362972013147328e+03, 3.59011282748293024e+03, 3.59659746271856557e+03,
+    3.60308362350750940e+03, 3.60957130752599414e+03, 3.61606051245731942e+03, 3.62255123599182207e+03,
+    3.62904347582684250e+03, 3.63553722966669420e+03, 3.64203249522263104e+03, 3.64852927021281721e+03,
+    3.65502755236229359e+03, 3.66152733940294956e+03, 3.66802862907348981e+03, 3.67453141911940520e+03,
+    3.68103570729294188e+03, 3.68754149135307034e+03, 3.69404876906545542e+03, 3.70055753820242717e+03,
+    3.70706779654294996e+03, 3.71357954187259475e+03, 3.72009277198350719e+03, 3.72660748467437952e+03,
+    3.73312367775042276e+03, 3.73964134902333490e+03, 3.74616049631127544e+03, 3.75268111743883401e+03,
+    3.75920321023700399e+03, 3.76572677254315386e+03, 3.77225180220099719e+03, 3.77877829706056809e+03,
+    3.78530625497819028e+03, 3.79183567381645253e+03, 3.79836655144417864e+03, 3.80489888573640110e+03,
+    3.81143267457433421e+03, 3.81796791584534776e+03, 3.82450460744293923e+03, 3.83104274726670701e+03,
+    3.83758233322232445e+03, 3.84412336322151441e+03, 3.85066583518202106e+03, 3.85720974702758622e+03,
+    3.86375509668792029e+03, 3.87030188209868084e+03, 3.87685010120144352e+03, 3.88339975194367707e+03,
+    3.88995083227872055e+03, 3.89650334016575516e+03, 3.90305727356978105e+03, 3.90961263046159183e+03,
+    3.91616940881774963e+03, 3.92272760662056180e+03, 3.92928722185805509e+03, 3.93584825252395194e+03,
+    3.94241069661764550e+03, 3.94897455214417778e+03, 3.95553981711421284e+03, 3.96210648954401631e+03,
+    3.96867456745542813e+03, 3.97524404887584251e+03, 3.98181493183818202e+03, 3.98838721438087623e+03,
+    3.99496089454783669e+03, 4.00153597038843645e+03, 4.00811243995748464e+03, 4.01469030131520549e+03,
+    4.02126955252721564e+03, 4.02785019166450047e+03, 4.03443221680339366e+03, 4.04101562602555214e+03,
+    4.04760041741793793e+03, 4.05418658907279269e+03, 4.06077413908761764e+03, 4.06736306556515092e+03,
+    4.07395336661334750e+03, 4.08054504034535648e+03, 4.08713808487949882e+03, 4.09373249833924865e+03,
+    4.10032827885320967e+03, 4.10692542455509647e+03, 4.11352393358371137e+03, 4.12012380408292393e+03,
+    4.12672503420165231e+03, 4.13332762209384236e+03, 4.13993156591844217e+03, 4.14653686383939112e+03,
+    4.15314351402558896e+03, 4.15975151465088493e+03, 4.16636086389405227e+03, 4.17297155993877004e+03,
+    4.17958360097360310e+03, 4.18619698519198300e+03, 4.19281171079218620e+03, 4.19942777597731947e+03,
+    4.20604517895529352e+03, 4.21266391793881121e+03, 4.21928399114534113e+03, 4.22590539679710582e+03,
+    4.23252813312105536e+03, 4.23915219834885556e+03, 4.24577759071686341e+03, 4.25240430846611252e+03,
+    4.25903234984229221e+03, 4.26566171309572928e+03, 4.27229239648137172e+03, 4.27892439825876772e+03,
+    4.28555771669204751e+03, 4.29219235004990969e+03, 4.29882829660559582e+03, 4.30546555463688037e+03,
+    4.31210412242604707e+03, 4.31874399825987348e+03, 4.32538518042961368e+03, 4.33202766723098102e+03,
+    4.33867145696412899e+03, 4.34531654793363487e+03, 4.35196293844848242e+03, 4.35861062682204556e+03,
+    4.36525961137207014e+03, 4.37190989042065758e+03, 4.37856146229424758e+03, 4.38521432532360086e+03,
+    4.39186847784378460e+03, 4.39852391819415152e+03, 4.40518064471832986e+03, 4.41183865576420067e+03,
+    4.41849794968388505e+03, 4.42515852483372419e+03, 4.43182037957426928e+03, 4.43848351227026069e+03,
+    4.44514792129061061e+03, 4.45181360500839310e+03, 4.45848056180082222e+03, 4.46514879004924023e+03,
+    4.47181828813909760e+03, 4.47848905445994387e+03, 4.48516108740540494e+03, 4.49183438537317215e+03,
+    4.49850894676498683e+03, 4.50518476998662209e+03, 4.51186185344786918e+03, 4.51854019556252297e+03,
+    4.52521979474836735e+03, 4.53190064942715799e+03, 4.53858275802460776e+03, 4.54526611897037401e+03,
+    4.55195073069804130e+03, 4.55863659164511046e+03, 4.56532370025297678e+03, 4.57201205496692364e+03,
+    4.57870165423610251e+03, 4.58539249651352111e+03, 4.59208458025602795e+03, 4.59877790392429779e+03,
+    4.60547246598281890e+03, 4.61216826489987670e+03, 4.61886529914754374e+03, 4.62556356720165877e+03,
+    4.63226306754182042e+03, 4.63896379865136805e+03, 4.64566575901737087e+03, 4.65236894713061156e+03,
+    4.65907336148557624e+03, 4.66577900058043633e+03, 4.67248586291703850e+03, 4.67919394700089197e+03,
+    4.68590325134115028e+03, 4.69261377445060225e+03, 4.69932551484565829e+03, 4.70603847104633587e+03,
+    4.71275264157624497e+03, 4.71946802496257988e+03, 4.72618461973610101e+03, 4.73290242443112493e+03,
+    4.73962143758550974e+03, 4.74634165774064513e+03, 4.75306308344143599e+03, 4.75978571323629149e+03,
+    4.76650954567711233e+03, 4.77323457931927896e+03, 4.77996081272163792e+03, 4.78668824444648908e+03,
+    4.79341687305957385e+03, 4.80014669713006333e+03, 4.80687771523054471e+03, 4.81360992593701212e+03,
+    4.82034332782884940e+03, 4.82707791948882277e+03, 4.83381369950306453e+03, 4.84055066646106661e+03,
+    4.84728881895566246e+03, 4.85402815558301972e+03, 4.86076867494262660e+03, 4.86751037563727823e+03,
+    4.87425325627307029e+03, 4.88099731545938175e+03, 4.88774255180886576e+03, 4.89448896393743962e+03,
+    4.90123655046426848e+03, 4.90798531001175979e+03, 4.91473524120554885e+03, 4.92148634267448597e+03,
+    4.92823861305062746e+03, 4.93499205096922469e+03, 4.94174665506871315e+03, 4.94850242399069703e+03,
+    4.95525935637994462e+03, 4.96201745088437292e+03, 4.96877670615503666e+03, 4.97553712084611925e+03,
+    4.98229869361492365e+03, 4.98906142312185602e+03, 4.99582530803041846e+03, 5.00259034700719894e+03,
+    5.00935653872185867e+03, 5.01612388184712472e+03, 5.02289237505877281e+03, 5.02966201703562547e+03,
+    5.03643280645953473e+03, 5.04320474201537399e+03, 5.04997782239102980e+03, 5.05675204627738731e+03,
+    5.06352741236832389e+03, 5.07030391936069555e+03, 5.07708156595433047e+03, 5.08386035085201638e+03,
+    5.09064027275948865e+03, 5.09742133038542488e+03, 5.10420352244143123e+03, 5.11098684764203517e+03,
+    5.11777130470467273e+03, 5.12455689234968122e+03, 5.13134360930028561e+03, 5.13813145428259577e+03,
+    5.14492042602558740e+03, 5.15171052326110112e+03, 5.15850174472382787e+03, 5.16529408915129898e+03,
+    5.17208755528387883e+03, 5.17888214186475489e+03, 5.18567784763992859e+03, 5.19247467135820352e+03,
+    5.19927261177117816e+03, 5.20607166763323676e+03, 5.21287183770153933e+03, 5.21967312073601079e+03,
+    5.22647551549933542e+03, 5.23327902075694328e+03, 5.24008363527700658e+03, 5.24688935783042325e+03,
+    5.25369618719081518e+03, 5.26050412213451546e+03, 5.26731316144055836e+03, 5.27412330389067301e+03,
+    5.28093454826927518e+03, 5.28774689336345182e+03, 5.29456033796296288e+03, 5.30137488086022313e+03,
+    5.30819052085029762e+03, 5.31500725673089255e+03, 5.32182508730234622e+03, 5.32864401136762172e+03,
+    5.33546402773229602e+03, 5.34228513520455272e+03, 5.34910733259517292e+03, 5.35593061871752889e+03,
+    5.36275499238757220e+03, 5.36958045242382741e+03, 5.37640699764738383e+03, 5.38323462688188647e+03,
+    5.39006333895352873e+03, 5.39689313269104059e+03, 5.40372400692568681e+03, 5.41055596049125324e+03,
+    5.41738899222403870e+03, 5.42422310096285310e+03, 5.43105828554900017e+03, 5.43789454482627752e+03,
+    5.44473187764096292e+03, 5.45157028284180979e+03, 5.45840975928003900e+03, 5.46525030580932798e+03,
+    5.47209192128580526e+03, 5.47893460456804405e+03, 5.48577835451704959e+03, 5.49262316999625818e+03,
+    5.49946904987152266e+03, 5.50631599301110782e+03, 5.51316399828568410e+03, 5.52001306456831753e+03,
+    5.52686319073446248e+03, 5.53371437566195709e+03, 5.54056661823100876e+03, 5.54741991732419501e+03,
+    5.55427427182644988e+03, 5.56112968062505934e+03, 5.56798614260965405e+03, 5.57484365667219936e+03,
+    5.58170222170699071e+03, 5.58856183661064551e+03, 5.59542250028209310e+03, 5.60228421162257382e+03,
+    5.60914696953562543e+03, 5.61601077292707851e+03, 5.62287562070504919e+03, 5.62974151177993281e+03,
+    5.63660844506439480e+03, 5.64347641947336524e+03, 5.65034543392403066e+03, 5.65721548733582858e+03,
+    5.66408657863043936e+03, 5.67095870673177797e+03, 5.67783187056599127e+03, 5.68470606906144440e+03,
+    5.69158130114872074e+03, 5.69845756576061103e+03, 5.70533486183210880e+03, 5.71221318830040036e+03,
+    5.71909254410486028e+03, 5.72597292818704682e+03, 5.73285433949068920e+03, 5.73973677696168670e+03,
+    5.74662023954810047e+03, 5.75350472620014261e+03, 5.76039023587017800e+03, 5.76727676751270792e+03,
+    5.77416432008437278e+03, 5.78105289254393847e+03, 5.78794248385229275e+03, 5.79483309297243977e+03,
+    5.80172471886949188e+03, 5.80861736051066418e+03, 5.81551101686526727e+03, 5.82240568690469991e+03,
+    5.82930136960244818e+03, 5.83619806393407089e+03, 5.84309576887719959e+03, 5.84999448341152947e+03,
+    5.85689420651881483e+03, 5.86379493718285994e+03, 5.87069667438951637e+03, 5.87759941712667478e+03,
+    5.88450316438425943e+03, 5.89140791515422097e+03, 5.89831366843053274e+03, 5.90522042320918081e+03,
+    5.91212817848816303e+03, 5.91903693326747816e+03, 5.92594668654912311e+03, 5.93285743733708568e+03,
+    5.93976918463733728e+03, 5.94668192745783017e+03, 5.95359566480849026e+03, 5.96051039570120884e+03,
+    5.96742611914983991e+03, 5.97434283417019378e+03, 5.98126053978002892e+03, 5.98817923499904919e+03,
+    5.99509891884889657e+03, 6.00201959035314485e+03, 6.00894124853729591e+03, 6.01586389242877249e+03,
+    6.02278752105691092e+03, 6.02971213345295928e+03, 6.03663772865007013e+03, 6.04356430568329233e+03,
+    6.05049186358957104e+03, 6.05742040140773497e+03, 6.06434991817849914e+03, 6.07128041294445029e+03
+};
 
-    if (N <= 32) {
-        // pre-computed binary search tree
-        if (N <= 16) {
-            if (N <= 8) {
-	        if (N <= 4) {
-		    if (N <= 2) {
-		        if (N <= 1) {
-			    f = 0.0f; // 0, 1
-			} else {
-			    f = 0.693147180559945f; // 2 
-			}
-		    } else {
-		        if (N <= 3) {
-			    f = 1.791759469228055f; // 3
-			} else {
-			    f = 3.178053830347946f; // 4
-			}
-		    }
-		} else {
-		    if (N <= 6) {
-			if (N <= 5) {
-			    f = 4.787491742782046f; // 5
-			} else {
-			    f = 6.579251212010101f; // 6
-			}
-		    } else {
-		        if (N <= 7) {
-			    f = 8.525161361065415f; // 7
-			} else {
-			    f = 10.604602902745251f; // 8
-			}
-		    }
-		}
-	    } else {
-		if (N <= 12) {
-		    if (N <= 10) {
-			if (N <= 9) {
-			    f = 12.801827480081469f; // 9
-			} else {
-			    f = 15.104412573075516f; // 10
-		        }
-		    } else {
-			if (N <= 11) {
-			    f = 17.502307845873887f; // 11
-			} else {
-			    f = 19.987214495661885f; // 12
-			}
-		    }
-		} else {
-		    if (N <= 14) {
-		        if (N <= 13) {
-			    f = 22.552163853123425f; // 13
-			} else {
-			    f = 25.191221182738680f; // 14
-			}
-		    } else {
-			if (N <= 15) {
-			    f = 27.899271383840890f; // 15
-			} else {
-			    f = 30.671860106080672f; // 16
-			}
-		    }
-		}
-            }
-	} else {
-	    if (N <= 24) {
-	        if (N <= 20) {
-		    if (N <= 18) {
-		        if (N <= 17) {
-			    f = 33.505073450136891f; // 17
-			} else {
-			    f = 36.395445208033053f; // 18
-			}
-		    } else {
-			if (N <= 19) {
-			    f = 39.339884187199495f; // 19
-			} else {
-			    f = 42.335616460753485f; // 20
-			}
-		    }
-		} else {
-		    if (N <= 22) {
-			if (N <= 21) {
-			    f = 45.380138898476908f; // 21
-			} else {
-			    f = 48.471181351835227f; // 22
-		        }
-		    } else {
-		        if (N <= 23) {
-			    f = 51.606675567764377f; // 23
-			} else {
-			    f = 54.784729398112319f; // 24
-			}
-		    }
-		}
-	    } else {
-		if (N <= 28) {
-		    if (N <= 26) {
-			if (N <= 25) {
-			    f = 58.003605222980518f; // 25
-			} else {
-			    f = 61.261701761002001f; // 26
-			}
-		    } else {
-			if (N <= 27) {
-			    f = 64.557538627006338f; // 27
-			} else {
-			    f = 67.889743137181540f; // 28
-			}
-		    }
-		} else {
-		    if (N <= 30) {
-			if (N <= 29) {
-			    f = 71.257038967168015f; // 29
-			} else {
-			    f = 74.658236348830158f; // 30
-			}
-		    } else {
-			if (N <= 32) {
-			    f = 78.092223553315307f; // 31
-			} else {
-			    f = 81.557959456115043f; // 32
-			}
-		    }
-		}
-	    }
-	}
-	// end of hard-coded binary tree
-    } else {
-	// use Stirling's approximation:
-	// ln(n!) = n ln(n) + 0.5ln(2 PI n) - n + 1/(12 n)
 
-	f = (N + 0.5) * logf(N) + 0.5 * LN2PI32 - N + 1 / (12 * N);
+float logFactorial32(float N) {
+    float r = 0.0f;
+
+    // also catches NaN
+    if (!(N >= 2.0f)) {
+        return (0.0f);
+    }
+    if (N < LOGFACTORIAL_TABLE) {
+        return ((float)logFactorialTable[(uint32_t)N]);
     }
 
-    return (f);
+    r = 1.0f / (N * N);
+    return ((N + 0.5f) * logf(N) - N + 0.5f * LN2PI32 + (1.0f / 12.0f - r / 360.0f) / N);
 }
 
 
-
-/*
- * re-write of the log factorial code
- */
 double logFactorial64(double N) {
-    double f = 0.0;
-
-    if (N <= 32) {
-        // pre-computed binary search tree
-        if (N <= 16) {
-            if (N <= 8) {
-	        if (N <= 4) {
-		    if (N <= 2) {
-		        if (N <= 1) {
-			    f = 0.0f;  // 0, 1
-			} else {
-			    f = 0.693147180559945; // 2
-			}
-		    } else {
-		        if (N <= 3) {
-			    f = 1.791759469228055; // 3
-			} else {
-			    f = 3.178053830347946; // 4
-			}
-		    }
-		} else {
-		    if (N <= 6) {
-			if (N <= 5) {
-			    f = 4.787491742782046; // 5
-			} else {
-			    f = 6.579251212010101; // 6
-			}
-		    } else {
-		        if (N <= 7) {
-			    f = 8.525161361065415; // 7
-			} else {
-			    f = 10.604602902745251; // 8
-			}
-		    }
-		}
-	    } else {
-		if (N <= 12) {
-		    if (N <= 10) {
-			if (N <= 9) {
-			    f = 12.801827480081469; // 9
-			} else {
-			    f = 15.104412573075516; // 10
-		        }
-		    } else {
-			if (N <= 11) {
-			    f = 17.502307845873887; // 11
-			} else {
-			    f = 19.987214495661885; // 12
-			}
-		    }
-		} else {
-		    if (N <= 14) {
-		        if (N <= 13) {
-			    f = 22.552163853123425; // 13
-			} else {
-			    f = 25.191221182738680; // 14
-			}
-		    } else {
-			if (N <= 15) {
-			    f = 27.899271383840890; // 15
-			} else {
-			    f = 30.671860106080672; // 16
-			}
-		    }
-		}
-            }
-	} else {
-	    if (N <= 24) {
-	        if (N <= 20) {
-		    if (N <= 18) {
-		        if (N <= 17) {
-			    f = 33.505073450136891; // 17
-			} else {
-			    f = 36.395445208033053; // 18
-			}
-		    } else {
-			if (N <= 19) {
-			    f = 39.339884187199495; // 19
-			} else {
-			    f = 42.335616460753485; // 20
-			}
-		    }
-		} else {
-		    if (N <= 22) {
-			if (N <= 21) {
-			    f = 45.380138898476908; // 21
-			} else {
-			    f = 48.471181351835227; // 22
-		        }
-		    } else {
-		        if (N <= 23) {
-			    f = 51.606675567764377; // 23
-			} else {
-			    f = 54.784729398112319; // 24
-			}
-		    }
-		}
-	    } else {
-		if (N <= 28) {
-		    if (N <= 26) {
-			if (N <= 25) {
-			    f = 58.003605222980518; // 25
-			} else {
-			    f = 61.261701761002001; // 26
-			}
-		    } else {
-			if (N <= 27) {
-			    f = 64.557538627006338; // 27
-			} else {
-			    f = 67.889743137181540; // 28
-			}
-		    }
-		} else {
-		    if (N <= 30) {
-			if (N <= 29) {
-			    f = 71.257038967168015; // 29
-			} else {
-			    f = 74.658236348830158; // 30
-			}
-		    } else {
-			if (N <= 32) {
-			    f = 78.092223553315307; // 31
-			} else {
-			    f = 81.557959456115043; // 32
-			}
-		    }
-		}
-	    }
-	}
-	// end of hard-coded binary tree
-    } else {
-	// use Stirling's approximation:
-	// ln(n!) = n ln(n) + 0.5ln(2 PI n) - n + 1/(12 n)
+    double r = 0.0;
 
-	f = (N + 0.5) * log(N) + 0.5 * LN2PI32 - N + 1 / (12 * N);
+    // also catches NaN
+    if (!(N >= 2.0)) {
+        return (0.0);
+    }
+    if (N < LOGFACTORIAL_TABLE) {
+        return (logFactorialTable[(uint32_t)N]);
     }
 
-    return (f);
+    r = 1.0 / (N * N);
+    return ((N + 0.5) * log(N) - N + 0.5 * LN2PI64 + (1.0 / 12.0 - r * (1.0 / 360.0 - r / 1260.0)) / N);
 }
 
 
@@ -818,83 +1721,86 @@ uint32_t poissMultiply64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds,
 }
 
 
-uint32_t poissRejection32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, float* sample,float lambda) {
-    uint32_t _err = 0;
-
-    // values depending on lambda:
-    float beta = PI32 / sqrtf(3.0f * lambda);
-    float alpha = beta * lambda;
-    float c = 0.767f - 3.36f / lambda;
-    float k = logf(c) - lambda - logf(beta);
+/*
+ * PTRS, Hoermann (1993), for lambda >= 10. As for BTPE the set-up is kept
+ * in an rngdist and everything is computed in double precision, the
+ * acceptance test subtracts terms of the order lambda * log(lambda).
+ */
+static void ptrsSetup(rngdist *d, double lambda) {
+    d->par.ptrs.lambda = lambda;
+    d->par.ptrs.loglam = log(lambda);
+    d->par.ptrs.b = 0.931 + 2.53 * sqrt(lambda);
+    d->par.ptrs.a = -0.059 + 0.02483 * d->par.ptrs.b;
+    d->par.ptrs.invalpha = 1.1239 + 1.1328 / (d->par.ptrs.b - 3.4);
+    d->par.ptrs.vr = 0.9277 - 3.6224 / (d->par.ptrs.b - 2.0);
+}
 
-    float U1 = 0.0f, U2 = 0.0f, X = 0.0f, N = 0.0f, tmp1 = 0.0f, tmp2 = 0.0f;
 
-    do {
-         _err = unifrnd32(u, seeds, &U1);
-         X = (alpha - logf((1 - U1) / U1)) / beta;
+// one trial with the uniforms U, V, returns 1 and the sample k on acceptance
+static uint32_t ptrsTrial(const rngdist *d, double U, double V, double *k) {
+    double a = d->par.ptrs.a, b = d->par.ptrs.b;
+    double us = 0.0;
 
-         if (X < 0.0f)
-             continue;
+    U -= 0.5;
+    us = 0.5 - fabs(U);
+    *k = floor((2.0 * a / us + b) * U + d->par.ptrs.lambda + 0.43);
 
-         N = floorf(X);
-        _err = unifrnd32(u, seeds, &U2);
+    // immediate acceptance in the centre of the hat
+    if (us >= 0.07 && V <= d->par.ptrs.vr)
+        return(1);
 
-        tmp1 = alpha - beta * X + logf(U2 / ((1 + expf(alpha - beta * X)) * (1 + expf(alpha - beta * X))));
-        tmp2 = k + N * logf(lambda) - logFactorial32(N);
-    } while (tmp1 > tmp2);
-    *sample = N;
+    if (*k < 0.0 || (us < 0.013 && V > us))
+        return(0);
 
-    return(_err);
+    return(log(V * d->par.ptrs.invalpha / (a / (us * us) + b))
+           <= -d->par.ptrs.lambda + *k * d->par.ptrs.loglam - logFactorial64(*k));
 }
 
 
-uint32_t poissRejection64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, double* sample, double lambda) {
+uint32_t poissPTRS32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, float* sample, float lambda) {
     uint32_t _err = 0;
+    float U = 0.0f, V = 0.0f;
+    double k = 0.0;
+    rngdist d;
 
-    // values depending on lambda:
-    double beta = PI32 / sqrtf(3.0f * lambda);
-    double alpha = beta * lambda;
-    double c = 0.767f - 3.36f / lambda;
-    double k = logf(c) - lambda - logf(beta);
-
-    double U1 = 0.0f, U2 = 0.0f, X = 0.0f, N = 0.0f, tmp1 = 0.0f, tmp2 = 0.0f;
-
+    ptrsSetup(&d, lambda);
     do {
-         _err = unifrnd64(u, seeds, &U1);
-         X = (alpha - logf((1 - U1) / U1)) / beta;
+        _err = unifrnd32(u, seeds, &U);
+        _err = unifrnd32(u, seeds, &V);
+    } while(!ptrsTrial(&d, U, V, &k));
+    *sample = k;
+
+    return(_err);
+}
 
-         if (X < 0.0f)
-             continue;
 
-         N = floorf(X);
-        _err = unifrnd64(u, seeds, &U2);
+uint32_t poissPTRS64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, double* sample, double lambda) {
+    uint32_t _err = 0;
+    double U = 0.0, V = 0.0;
+    double k = 0.0;
+    rngdist d;
 
-        tmp1 = alpha - beta * X + logf(U2 / ((1 + expf(alpha - beta * X)) * (1 + expf(alpha - beta * X))));
-        tmp2 = k + N * logf(lambda) - logFactorial64(N);
-    } while (tmp1 > tmp2);
-    *sample = N;
+    ptrsSetup(&d, lambda);
+    do {
+        _err = unifrnd64(u, seeds, &U);
+        _err = unifrnd64(u, seeds, &V);
+    } while(!ptrsTrial(&d, U, V, &k));
+    *sample = k;
 
     return(_err);
 }
 
 
-// for large lambda approximate the Poisson distribution with the
-// normal distribution with mu = lambda and sigma^2 = lambda
 uint32_t poissrnd32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, float* sample, float* u2, float lambda) {
     uint32_t _err = 0;
     float _ftmp = 0.0f;
 
-    if (lambda <= 30.0f) {
+    if (lambda < 10.0f) {
         // for small values of N use the direct multiplication method
         _err = poissMultiply32(u, seeds, &_ftmp, lambda);
-    } else if (lambda <= 100.0f) {
-        // for intermediate values of N apply rejection sampling
-        _err = poissRejection32(u, seeds, &_ftmp, lambda);
     } else {
-        // approximation using the central limit theorem (CLT)
-        // using the positive part of the CDF Phi((x - lambda) / sqrt(lambda))
-        _err = normrnd32(u, seeds, &_ftmp, u2, lambda, sqrtf(lambda));
-        _ftmp = fmaxf(0.0f, floorf(_ftmp));
+        // transformed rejection with squeeze
+        _err = poissPTRS32(u, seeds, &_ftmp, lambda);
     }
     *sample = _ftmp;
 
@@ -902,23 +1808,16 @@ uint32_t poissrnd32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, floa
 }
 
 
-// for large lambda approximate the Poisson distribution with the
-// normal distribution with mu = lambda and sigma^2 = lambda
 uint32_t poissrnd64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, double* sample, double* u2, double lambda) {
     uint32_t _err = 0;
     double _ftmp = 0.0f;
 
-    if (lambda <= 30.0f) {
+    if (lambda < 10.0f) {
         // for small values of N use the direct multiplication method
         _err = poissMultiply64(u, seeds, &_ftmp, lambda);
-    } else if (lambda <= 100.0f) {
-        // for intermediate values of N apply rejection sampling
-        _err = poissRejection64(u, seeds, &_ftmp, lambda);
     } else {
-        // approximation using the central limit theorem (CLT)
-        // using the positive part of the CDF Phi((x - lambda) / sqrt(lambda))
-        _err = normrnd64(u, seeds, &_ftmp, u2, lambda, sqrtf(lambda));
-        _ftmp = fmaxf(0.0f, floorf(_ftmp));
+        // transformed rejection with squeeze
+        _err = poissPTRS64(u, seeds, &_ftmp, lambda);
     }
     *sample = _ftmp;
 
@@ -993,3 +1892,293 @@ uint32_t betarnd64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, doubl
     return(_err);
 }
 
+
+/***********************
+ * Prepared distributions
+ **********************/
+
+uint32_t distinit(rngdist *d, uint32_t distribution, double a, double b) {
+    double p = 0.0;
+
+    d->distribution = distribution;
+    d->flip = 0;
+
+    if(distribution == TINYRNG_EXP) {
+        if(!(a > 0.0)) return(TINYRNG_INTERVAL_ERROR);
+        d->method = TINYRNG_METHOD_EXP;
+        d->par.exp.inv = 1.0 / a;
+    } else if(distribution == TINYRNG_NORMAL) {
+        if(!(b >= 0.0)) return(TINYRNG_INTERVAL_ERROR);
+        d->method = TINYRNG_METHOD_NORMAL;
+        d->par.norm.mu = a;
+        d->par.norm.sigma = b;
+    } else if(distribution == TINYRNG_GAMMA) {
+        if(!(a > 0.0 && b > 0.0)) return(TINYRNG_INTERVAL_ERROR);
+        d->method = TINYRNG_METHOD_GAMMA;
+        // alpha <= 1 is boosted to alpha + 1 and scaled by u^(1 / alpha)
+        d->par.gamma.invalpha = (a <= 1.0) ? 1.0 / a : 0.0;
+        d->par.gamma.d = ((a <= 1.0) ? a + 1.0 : a) - 0.33333333333333;
+        d->par.gamma.c = 0.33333333333333 / sqrt(d->par.gamma.d);
+        d->par.gamma.beta = b;
+    } else if(distribution == TINYRNG_BETA) {
+        if(!(a > 0.0 && b > 0.0)) return(TINYRNG_INTERVAL_ERROR);
+        d->method = TINYRNG_METHOD_BETA;
+        d->par.beta.alpha = a;
+        d->par.beta.beta = b;
+        d->par.beta.s = a + b;
+        if(fmin(a, b) <= 1.0) {
+            d->par.beta.lambda = fmin(a, b);
+        } else {
+            d->par.beta.lambda = sqrt((2 * a * b - d->par.beta.s) / (d->par.beta.s - 2));
+        }
+        d->par.beta.u = a + d->par.beta.lambda;
+        d->par.beta.ln4 = log(4.0);
+    } else if(distribution == TINYRNG_POISSON) {
+        if(!(a >= 0.0)) return(TINYRNG_INTERVAL_ERROR);
+        if(a < 10.0) {
+            d->method = TINYRNG_METHOD_MULTIPLY;
+            d->par.multiply.L = exp(-a);
+        } else {
+            d->method = TINYRNG_METHOD_PTRS;
+            ptrsSetup(d, a);
+        }
+    } else if(distribution == TINYRNG_BINOMIAL) {
+        if(!(a >= 0.0 && a == floor(a) && b >= 0.0 && b <= 1.0)) return(TINYRNG_INTERVAL_ERROR);
+        // sample the count of the less likely outcome as binomialrnd does
+        p = (b > 0.5) ? 1.0 - b : b;
+        d->flip = (p != b);
+        if(a < 10.0 || a * p < 30.0) {
+            d->method = (a < 10.0) ? TINYRNG_METHOD_BERNOULLI : TINYRNG_METHOD_GEOMETRIC;
+            d->par.trials.n = a;
+            d->par.trials.p = p;
+            d->par.trials.c = log(1.0 - p);
+        } else {
+            d->method = TINYRNG_METHOD_BTPE;
+            btpeSetup(d, a, p);
+        }
+    } else {
+        return(TINYRNG_INTERVAL_ERROR);
+    }
+
+    return(TINYRNG_OK);
+}
+
+
+// Marsaglia & Tsang, one trial with the normal x and the uniform u1
+static uint32_t gammaTrial(const rngdist *d, double x, double u1, double *v) {
+    *v = 1.0 + d->par.gamma.c * x;
+    *v = *v * *v * *v;
+
+    return(*v > 0.0 && log(u1) < 0.5 * x * x + d->par.gamma.d * (1.0 - *v + log(*v)));
+}
+
+
+// Cheng's algorithm BA, one trial with the uniforms u1, u2
+static uint32_t betaTrial(const rngdist *d, double u1, double u2, double *y) {
+    double v = 0.0;
+
+    if(u1 >= 1.0) return(0);
+
+    v = log(u1 / (1 - u1)) / d->par.beta.lambda;
+    *y = d->par.beta.alpha * exp(v);
+
+    return(d->par.beta.s * log(d->par.beta.s / (d->par.beta.beta + *y)) + d->par.beta.u * v - d->par.beta.ln4
+           >= log(u1 * u1 * u2));
+}
+
+
+uint32_t distrnd32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, const rngdist *d, float *sample) {
+    uint32_t _err = 0;
+    float f1 = 0.0f, f2 = 0.0f;
+    double x = 0.0, prefix = 1.0;
+    uint32_t all = 0, w = 0;
+
+    switch(d->method) {
+    case TINYRNG_METHOD_EXP:
+        // 1 - f1 is never zero
+        _err = unifrnd32(u, seeds, &f1);
+        x = -log(1.0 - f1) * d->par.exp.inv;
+        break;
+    case TINYRNG_METHOD_NORMAL:
+        _err = normstdzig32(u, seeds, &f1);
+        x = d->par.norm.mu + d->par.norm.sigma * f1;
+        break;
+    case TINYRNG_METHOD_GAMMA:
+        if(d->par.gamma.invalpha > 0.0) {
+            _err = unifrnd32(u, seeds, &f1);
+            prefix = pow(f1, d->par.gamma.invalpha);
+        }
+        do {
+            _err = normstdzig32(u, seeds, &f1);
+            _err = unifrnd32(u, seeds, &f2);
+        } while(!gammaTrial(d, f1, f2, &x));
+        x = prefix * d->par.gamma.d * x * d->par.gamma.beta;
+        break;
+    case TINYRNG_METHOD_BETA:
+        do {
+            _err = unifrnd32(u, seeds, &f1);
+            _err = unifrnd32(u, seeds, &f2);
+        } while(!betaTrial(d, f1, f2, &x));
+        x = x / (d->par.beta.beta + x);
+        break;
+    case TINYRNG_METHOD_MULTIPLY:
+        x = -1.0;
+        prefix = 1.0;
+        do {
+            x++;
+            _err = unifrnd32(u, seeds, &f1);
+            prefix *= f1;
+        } while(prefix > d->par.multiply.L);
+        break;
+    case TINYRNG_METHOD_PTRS:
+        do {
+            _err = unifrnd32(u, seeds, &f1);
+            _err = unifrnd32(u, seeds, &f2);
+        } while(!ptrsTrial(d, f1, f2, &x));
+        break;
+    case TINYRNG_METHOD_BERNOULLI:
+        // n < 10 trials side by side, p <= 0.5
+        _err = bernoulliLanes32(u, seeds, bernoulliFraction32(d->par.trials.p, &all), (uint32_t)d->par.trials.n, &w);
+        x = popcount64(w);
+        break;
+    case TINYRNG_METHOD_GEOMETRIC:
+        // Devroye's geometric method, sum of geometric waiting times
+        if(d->par.trials.c != 0.0) {
+            x = -1.0;
+            prefix = 0.0;
+            do {
+                _err = unifrnd32(u, seeds, &f1);
+                prefix += ceil(log(f1) / d->par.trials.c);
+                x++;
+            } while(prefix <= d->par.trials.n);
+        }
+        break;
+    case TINYRNG_METHOD_BTPE:
+        do {
+            _err = unifrnd32(u, seeds, &f1);
+            _err = unifrnd32(u, seeds, &f2);
+        } while(!btpeTrial(d, f1, f2, &x));
+        break;
+    default:
+        return(TINYRNG_INTERVAL_ERROR);
+    }
+
+    // n is the first member of both trials and btpe
+    if(d->flip) {
+        x = d->par.trials.n - x;
+    }
+    *sample = x;
+
+    return(_err);
+}
+
+
+uint32_t distrnd64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, const rngdist *d, double *sample) {
+    uint32_t _err = 0;
+    double f1 = 0.0, f2 = 0.0;
+    double x = 0.0, prefix = 1.0;
+    uint64_t w = 0;
+    uint32_t all = 0;
+
+    switch(d->method) {
+    case TINYRNG_METHOD_EXP:
+        // 1 - f1 is never zero
+        _err = unifrnd64(u, seeds, &f1);
+        x = -log(1.0 - f1) * d->par.exp.inv;
+        break;
+    case TINYRNG_METHOD_NORMAL:
+        _err = normstdzig64(u, seeds, &f1);
+        x = d->par.norm.mu + d->par.norm.sigma * f1;
+        break;
+    case TINYRNG_METHOD_GAMMA:
+        if(d->par.gamma.invalpha > 0.0) {
+            _err = unifrnd64(u, seeds, &f1);
+            prefix = pow(f1, d->par.gamma.invalpha);
+        }
+        do {
+            _err = normstdzig64(u, seeds, &f1);
+            _err = unifrnd64(u, seeds, &f2);
+        } while(!gammaTrial(d, f1, f2, &x));
+        x = prefix * d->par.gamma.d * x * d->par.gamma.beta;
+        break;
+    case TINYRNG_METHOD_BETA:
+        do {
+            _err = unifrnd64(u, seeds, &f1);
+            _err = unifrnd64(u, seeds, &f2);
+        } while(!betaTrial(d, f1, f2, &x));
+        x = x / (d->par.beta.beta + x);
+        break;
+    case TINYRNG_METHOD_MULTIPLY:
+        x = -1.0;
+        prefix = 1.0;
+        do {
+            x++;
+            _err = unifrnd64(u, seeds, &f1);
+            prefix *= f1;
+        } while(prefix > d->par.multiply.L);
+        break;
+    case TINYRNG_METHOD_PTRS:
+        do {
+            _err = unifrnd64(u, seeds, &f1);
+            _err = unifrnd64(u, seeds, &f2);
+        } while(!ptrsTrial(d, f1, f2, &x));
+        break;
+    case TINYRNG_METHOD_BERNOULLI:
+        // n < 10 trials side by side, p <= 0.5
+        _err = bernoulliLanes64(u, seeds, bernoulliFraction64(d->par.trials.p, &all), (uint32_t)d->par.trials.n, &w);
+        x = popcount64(w);
+        break;
+    case TINYRNG_METHOD_GEOMETRIC:
+        // Devroye's geometric method, sum of geometric waiting times
+        if(d->par.trials.c != 0.0) {
+            x = -1.0;
+            prefix = 0.0;
+            do {
+                _err = unifrnd64(u, seeds, &f1);
+                prefix += ceil(log(f1) / d->par.trials.c);
+                x++;
+            } while(prefix <= d->par.trials.n);
+        }
+        break;
+    case TINYRNG_METHOD_BTPE:
+        do {
+            _err = unifrnd64(u, seeds, &f1);
+            _err = unifrnd64(u, seeds, &f2);
+        } while(!btpeTrial(d, f1, f2, &x));
+        break;
+    default:
+        return(TINYRNG_INTERVAL_ERROR);
+    }
+
+    // n is the first member of both trials and btpe
+    if(d->flip) {
+        x = d->par.trials.n - x;
+    }
+    *sample = x;
+
+    return(_err);
+}
+
+
+uint32_t distfill32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, const rngdist *d, float *samples, uint32_t n) {
+    uint32_t _err = 0;
+    uint32_t i = 0;
+
+    for(i = 0; i < n && _err == 0; i++) {
+        _err = distrnd32(u, seeds, d, samples + i);
+    }
+
+    return(_err);
+}
+
+
+uint32_t distfill64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, const rngdist *d, double *samples, uint32_t n) {
+    uint32_t _err = 0;
+    uint32_t i = 0;
+
+    for(i = 0; i < n && _err == 0; i++) {
+        _err = distrnd64(u, seeds, d, samples + i);
+    }
+
+    return(_err);
+}
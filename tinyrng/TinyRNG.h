@@ -44,14 +44,27 @@
 #define TWOPI64 6.283185307179586
 #define PI32 3.141592653589793f
 #define PI64 3.141592653589793
-#define LN2PI32 1.83787706641f
-#define LN2PI64 1.83787706641
+#define LN2PI32 1.837877066409345f
+#define LN2PI64 1.8378770664093454836
 
 
 // define library specific error codes
 #define TINYRNG_OK 0
 #define TINYRNG_SEED_ERROR 10001
 #define TINYRNG_INTERVAL_ERROR 10002
+#define TINYRNG_MEMORY_ERROR 10003
+
+
+/*
+ * Header-only mode. With TINYRNG_INLINE defined before this header the
+ * scalar generators, unifrnd, exprnd and normstdrnd are static inline
+ * functions from TinyRNGinline.h, so the compiler can inline the
+ * generator into the transformation. Everything else still comes from
+ * libtinyrng.
+ */
+#ifdef TINYRNG_INLINE
+#include "TinyRNGinline.h"
+#endif
 
 
 /***********************************
@@ -62,28 +75,53 @@
  * This is a generic function to seed an RNG. To be more flexible, we are 
  * giving the number of seeds to be generated  If an RNG requires a special
  * seedingfunction, such as the KISS RNG, it has to be provided.
- * The seeds are read form /dev/urandom
+ * The seeds are read with a single getrandom() call, or a single read
+ * from /dev/urandom where getrandom() is not available.
  */
 uint32_t seed(uint32_t *seeds, uint32_t l);
 
 /*
  * For internal use only. This bit is actually platform dependent of TinyRNG.
- * It reads a single 32-bit seed from /dev/urandom.
+ * getSeeds fills l seeds from the operating system in one go, getSeed
+ * reads a single 32-bit seed.
  */
+uint32_t getSeeds(uint32_t *seeds, uint32_t l);
 uint32_t getSeed(uint32_t *seed);
 
 /*
  * Special purpose seeding function for Marsaglia's KISS RNG.
- * It reads 4 seeds from /dev/urandom, but seeds[1] must not be 0.
+ * It reads 4 seeds in one go, but seeds[1] must not be 0.
  * seeds[4] is the carry bit.
  */
 uint32_t seedkiss(uint32_t *seeds);
 
+/*
+ * Seeding functions for the native 64-bit generators below.
+ * seedxorshift64w fills 4 words and makes sure the state is not all zero.
+ * seedkiss64w fills 8 words, seeds[4..5] (the XORSHIFT part) must not be 0
+ * and the carry seeds[2..3] is kept below the MWC multiplier 2^58.
+ */
+uint32_t seedxorshift64w(uint32_t *seeds);
+uint32_t seedkiss64w(uint32_t *seeds);
+
+/*
+ * Deterministic seeding from a single 64-bit value, e.g. to replay a run
+ * by logging one integer. The value is expanded by SplitMix64 and no
+ * system call is made. The same constraints as above are enforced:
+ * seedfrom never returns l zero words, seedkissfrom keeps seeds[1] != 0
+ * and also sets the carry seeds[4].
+ */
+uint32_t seedfrom(uint32_t *seeds, uint32_t l, uint64_t s);
+uint32_t seedkissfrom(uint32_t *seeds, uint64_t s);
+uint32_t seedxorshift64wfrom(uint32_t *seeds, uint64_t s);
+uint32_t seedkiss64wfrom(uint32_t *seeds, uint64_t s);
+
 
 /****************************************************************
  * Generate 32-bits / 64-bits of uniformly distributed randomness
  ***************************************************************/
 
+#ifndef TINYRNG_INLINE
 // XORSHIFT - 32-bit uniform random number generators
 uint32_t xorshift32(uint32_t *seeds, uint32_t *sample);
 
@@ -95,6 +133,177 @@ uint32_t kiss32(uint32_t *seeds, uint32_t *sample);
 
 // KISS - true 64-bit of randomness
 uint32_t kiss64(uint32_t *seeds, uint64_t *sample);
+#endif
+
+/*
+ * Native 64-bit generators. Unlike xorshift64 and kiss64 they produce
+ * one 64-bit word per state update. The 64-bit state words are stored
+ * in the uint32_t seed array, low word first, so they plug into all
+ * 64-bit transformations, e.g. unifrnd64(kiss64w, seeds, &sample).
+ *
+ * xorshift64w is the xorshift128+ member of the XORSHIFT family, it
+ * uses 4 seeds and has period 2^128 - 1.
+ * Reference:
+ * Vigna, S., "Further scramblings of Marsaglia's xorshift generators",
+ * Journal of Computational and Applied Mathematics, 2017, 315, 175-181
+ *
+ * kiss64w is Marsaglia's 64-bit KISS (MWC + XORSHIFT + congruential),
+ * it uses 8 seeds and has period > 2^250.
+ * Reference:
+ * Marsaglia, G., "64-bit KISS RNGs", comp.lang.fortran, 2009
+ */
+#ifndef TINYRNG_INLINE
+uint32_t xorshift64w(uint32_t *seeds, uint64_t *sample);
+uint32_t kiss64w(uint32_t *seeds, uint64_t *sample);
+#endif
+
+
+/*****************************************************************
+ * Bulk generation: fill an array of n words in a single call.
+ *
+ * The generator state is kept in local variables for the whole
+ * loop and written back to seeds once at the end. The produced
+ * stream is identical to n consecutive calls of the scalar
+ * generator, so both may be mixed freely on the same seeds.
+ ****************************************************************/
+uint32_t xorshift32fill(uint32_t *seeds, uint32_t *samples, uint32_t n);
+uint32_t xorshift64fill(uint32_t *seeds, uint64_t *samples, uint32_t n);
+uint32_t kiss32fill(uint32_t *seeds, uint32_t *samples, uint32_t n);
+uint32_t kiss64fill(uint32_t *seeds, uint64_t *samples, uint32_t n);
+uint32_t xorshift64wfill(uint32_t *seeds, uint64_t *samples, uint32_t n);
+uint32_t kiss64wfill(uint32_t *seeds, uint64_t *samples, uint32_t n);
+
+
+/*****************************************************************
+ * Jump ahead
+ *
+ * Advance the state by 2^k steps of the 32-bit generator, e.g. to
+ * split the period into disjoint streams for parallel replicas.
+ * xorshift64 and kiss64 take two steps per sample, so jumping by
+ * k + 1 skips 2^k of their samples.
+ *
+ * The XORSHIFT state is linear over GF(2), the jump evaluates the
+ * polynomial x^(2^k) modulo the characteristic polynomial of the
+ * generator at its transition matrix. For KISS the XORSHIFT part
+ * is jumped the same way and the additive parts in closed form.
+ *
+ * Reference:
+ * Haramoto, H., Matsumoto, M., Nishimura, T., Panneton, F. & L'Ecuyer, P.,
+ * "Efficient jump ahead for F2-linear random number generators",
+ * INFORMS Journal on Computing, 2008, 20(3), 385-390
+ ****************************************************************/
+uint32_t xorshift32jump(uint32_t *seeds, uint32_t k);
+uint32_t kiss32jump(uint32_t *seeds, uint32_t k);
+
+
+/*****************************************************************
+ * Streams and substreams
+ *
+ * A stream manager expands one 64-bit master seed into the start
+ * state of stream 0 and hands out the start states of further
+ * streams by jumping ahead, so the streams never overlap. Every
+ * stream is split again into substreams, e.g. one per task or per
+ * replica of a thread.
+ *
+ *   generator             streams   stream length   substreams   substream length
+ *   TINYRNG_XORSHIFT32    2^60      2^100           2^40         2^60
+ *   TINYRNG_KISS32        2^23      2^40            2^20         2^20
+ *
+ * The lengths count steps of the 32-bit generator. streamget and
+ * substreamget are pure functions of the master seed and the indices,
+ * so they are thread safe and reproducible. streamnext hands out the
+ * streams 0, 1, 2, ... in turn and may be called from several threads.
+ * Indices out of range yield TINYRNG_INTERVAL_ERROR.
+ *
+ * Reference:
+ * L'Ecuyer, P., Simard, R., Chen, E. J. & Kelton, W. D.,
+ * "An object-oriented random-number package with many long streams and substreams",
+ * Operations Research, 2002, 50(6), 1073-1075
+ ****************************************************************/
+#define TINYRNG_XORSHIFT32 1
+#define TINYRNG_KISS32 2
+
+typedef struct {
+    uint32_t generator;
+    uint32_t base[5];
+    uint64_t next;
+} rngstreams;
+
+uint32_t streaminit(rngstreams *s, uint32_t generator, uint64_t master);
+uint32_t streamget(rngstreams *s, uint64_t i, uint32_t *seeds);
+uint32_t substreamget(rngstreams *s, uint64_t i, uint64_t j, uint32_t *seeds);
+uint32_t streamnext(rngstreams *s, uint32_t *seeds);
+
+
+/*****************************************************************
+ * Multi-lane XORSHIFT engine
+ *
+ * TINYRNG_VEC_LANES independent xorshift32 generators run in SIMD
+ * lanes (SSE2, AVX2 or AVX-512, picked at run time) with a portable
+ * scalar fallback producing the same stream. The lane states are
+ * interleaved in one aligned seed array of 5 * TINYRNG_VEC_LANES
+ * words, word w of lane l is seeds[w * TINYRNG_VEC_LANES + l].
+ * Every step yields one word per lane, lane 0 first, and lane l on
+ * its own is exactly the xorshift32 stream of its 5-word state.
+ *
+ * xorshift32vecfill has the signature of the bulk generators, so
+ * unifrnd32fill(xorshift32vecfill, v.seeds, buf, n) works. If n is
+ * not a multiple of TINYRNG_VEC_LANES the surplus words of the last
+ * step are dropped.
+ ****************************************************************/
+#define TINYRNG_VEC_LANES 16
+
+typedef struct {
+    uint32_t seeds[5 * TINYRNG_VEC_LANES] __attribute__((aligned(64)));
+} xorshift32vecstate;
+
+uint32_t seedxorshift32vec(uint32_t *seeds);
+
+// deterministic, lane l is stream l of streaminit(TINYRNG_XORSHIFT32, s)
+uint32_t seedxorshift32vecfrom(uint32_t *seeds, uint64_t s);
+uint32_t xorshift32vecfill(uint32_t *seeds, uint32_t *samples, uint32_t n);
+uint32_t xorshift32vecfillScalar(uint32_t *seeds, uint32_t *samples, uint32_t n);
+
+// move a single 5-word xorshift32 state in and out of lane l
+uint32_t xorshift32vecset(uint32_t *seeds, uint32_t l, uint32_t *lane);
+uint32_t xorshift32vecget(uint32_t *seeds, uint32_t l, uint32_t *lane);
+
+
+/*****************************************************************
+ * Counter-based generator Philox4x32-10
+ *
+ * philox4x32 maps a 128-bit counter and a 64-bit key to 128 random
+ * bits without any state, e.g. key = particle, counter = draw.
+ *
+ * philox32 / philox64 turn it into a generator with the usual
+ * signature, so it plugs into all transformations and bulk functions.
+ * The seed array holds TINYRNG_PHILOX_WORDS words:
+ *   seeds[0..1]   key, low word first
+ *   seeds[2..5]   counter of the next block, low word first
+ *   seeds[6]      number of unused words in the buffer
+ *   seeds[7..10]  buffer, the last seeds[6] words are unused
+ * Word i of the stream of a key is word i mod 4 of the block with
+ * counter i / 4. seedphilox sets the key and the position i, so
+ * any draw can be regenerated directly, e.g.
+ *   seedphilox(seeds, agent, 1000);
+ *   unifrnd64(philox64, seeds, &sample);
+ * yields the 501st uniform of agent. philox64 takes two words per
+ * sample like xorshift64. philox32fill / philox64fill compute 8 blocks
+ * at a time with AVX2 where available and produce the same stream.
+ *
+ * Reference:
+ * Salmon, J. K., Moraes, M. A., Dror, R. O. & Shaw, D. E.,
+ * "Parallel random numbers: as easy as 1, 2, 3",
+ * Proceedings of SC11, 2011
+ ****************************************************************/
+#define TINYRNG_PHILOX_WORDS 11
+
+uint32_t philox4x32(const uint32_t *key, const uint32_t *counter, uint32_t *out);
+uint32_t seedphilox(uint32_t *seeds, uint64_t key, uint64_t i);
+uint32_t philox32(uint32_t *seeds, uint32_t *sample);
+uint32_t philox64(uint32_t *seeds, uint64_t *sample);
+uint32_t philox32fill(uint32_t *seeds, uint32_t *samples, uint32_t n);
+uint32_t philox64fill(uint32_t *seeds, uint64_t *samples, uint32_t n);
 
 
 /*****************************************
@@ -114,8 +323,18 @@ uint32_t kiss64(uint32_t *seeds, uint64_t *sample);
 /*********************************
  * Uniform random sample on (0, 1]
  ********************************/
+#ifndef TINYRNG_INLINE
 uint32_t unifrnd32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, float *sample);
 uint32_t unifrnd64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, double *sample);
+#endif
+
+/*
+ * Bulk uniform samples on (0, 1]. These take one of the bulk
+ * generators above, e.g. unifrnd32fill(kiss32fill, seeds, buf, n),
+ * and produce the same samples as n calls of unifrnd32 / unifrnd64.
+ */
+uint32_t unifrnd32fill(uint32_t (*un)(uint32_t *, uint32_t *, uint32_t), uint32_t *seeds, float *samples, uint32_t n);
+uint32_t unifrnd64fill(uint32_t (*un)(uint32_t *, uint64_t *, uint32_t), uint32_t *seeds, double *samples, uint32_t n);
 
 
 /*********************************
@@ -128,8 +347,23 @@ uint32_t unifrndint64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, do
 /********************************************
  * Exponential random sample with mean lambda
  *******************************************/
+#ifndef TINYRNG_INLINE
 uint32_t exprnd32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, float *sample, float lambda);
 uint32_t exprnd64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, double *sample, double lambda);
+#endif
+
+/*
+ * Exponential random sample by the Ziggurat method, scaled by lambda
+ * the same way as exprnd. Most samples cost one generator word and one
+ * table compare instead of a log.
+ *
+ * Reference:
+ * Marsaglia, G. & Tsang, W. W.,
+ * "The Ziggurat method for generating random variables",
+ * Journal of Statistical Software, 2000, 5(8), 1-7
+ */
+uint32_t expzig32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, float *sample, float lambda);
+uint32_t expzig64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, double *sample, double lambda);
 
 
 /*******************************************************
@@ -144,8 +378,25 @@ uint32_t exprnd64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, double
  *  Annals of Mathematical Statistics, 1958, 29, 610-611
  *******************************************************/
 // u2 to make the function re-entrant (thread safe)
+#ifndef TINYRNG_INLINE
 uint32_t normstdrnd32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, float *sample, float *u2);  
 uint32_t normstdrnd64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, double *sample, double *u2);
+#endif
+
+/*
+ * Batched Box-Muller transform, fills n standard normal samples using
+ * one of the bulk generators. The uniforms are paired as in
+ * normstdrnd32 / normstdrnd64 and both results of a pair are written
+ * to samples, so the output matches repeated calls starting with
+ * *u2 = NAN up to rounding: log, sin and cos are evaluated by
+ * vectorised polynomial kernels (AVX2 where available), which differ
+ * from the libm path by less than 2e-6 absolute for float and 5e-15
+ * for double. Near zero the relative difference of the float path
+ * can reach a few percent. If n is odd the last second result is
+ * dropped.
+ */
+uint32_t normstdrnd32fill(uint32_t (*un)(uint32_t *, uint32_t *, uint32_t), uint32_t *seeds, float *samples, uint32_t n);
+uint32_t normstdrnd64fill(uint32_t (*un)(uint32_t *, uint64_t *, uint32_t), uint32_t *seeds, double *samples, uint32_t n);
 
 
 /******************************************************
@@ -161,6 +412,26 @@ uint32_t normrnd32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds,float
 uint32_t normrnd64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, double *sample, double *u2, double mu, double sigma);
 
 
+/*******************************************************
+ * Standard normal and normal random samples by the
+ * Ziggurat method. About 98% of the samples cost one
+ * generator word and one table compare, no u2 is needed.
+ *
+ * If TinyRNG is compiled with -DTINYRNG_ZIGGURAT, normrnd
+ * and gammarnd use the Ziggurat sampler as well and their
+ * u2 argument is ignored.
+ *
+ * Reference:
+ * Marsaglia, G. & Tsang, W. W.,
+ * "The Ziggurat method for generating random variables",
+ * Journal of Statistical Software, 2000, 5(8), 1-7
+ *******************************************************/
+uint32_t normstdzig32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, float *sample);
+uint32_t normstdzig64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, double *sample);
+uint32_t normzig32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, float *sample, float mu, float sigma);
+uint32_t normzig64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, double *sample, double mu, double sigma);
+
+
 /***************************************************
  * gamma random sample
  *
@@ -173,23 +444,52 @@ uint32_t gammarnd32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, floa
 uint32_t gammarnd64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, double* sample, double* u2, double alpha, double beta);
 
 
+/*******************************************************************
+ * Bernoulli random bits
+ *
+ * bernoullirnd32 / bernoullirnd64 return 32 / 64 independent
+ * Bernoulli(p) trials packed into one word, bit i is 1 with
+ * probability p. The bits of the generator words are compared with
+ * the binary expansion of p, all lanes at once, so a word of trials
+ * costs about 7 generator words instead of one uniform per trial, and
+ * p = 2^-k costs k words. p is resolved to 2^-32 (2^-64).
+ *
+ * bernoullifill32 / bernoullifill64 write n trials to a packed bitmask
+ * using one of the bulk generators, trial i is bit i % 32 (i % 64) of
+ * mask[i / 32] (mask[i / 64]), bits beyond n are cleared. p outside
+ * [0, 1] yields TINYRNG_INTERVAL_ERROR.
+ ******************************************************************/
+uint32_t bernoullirnd32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, uint32_t *bits, float p);
+uint32_t bernoullirnd64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, uint64_t *bits, double p);
+
+uint32_t bernoullifill32(uint32_t (*un)(uint32_t *, uint32_t *, uint32_t), uint32_t *seeds, uint32_t *mask, uint32_t n, float p);
+uint32_t bernoullifill64(uint32_t (*un)(uint32_t *, uint64_t *, uint32_t), uint32_t *seeds, uint64_t *mask, uint32_t n, double p);
+
+
 /*************************************************************************************************************
  * binomial random samples with number of trail n and probability p
  *
- * for small values of n < the sum of n Bernoulli trials is computed
+ * for small values of n < 10 the n Bernoulli trials are drawn side by side as bits, see bernoullirnd32, and
+ * counted.
  * References:
  * Knuth, D. E., "Art of Computer Programming - Seminumerical Algorithms",
  * Addison-Wesley, 1997, Vol. 2
  *
  * Devroye, L., "Non-uniform Random Variate Generation", Springer-Verlag, New York, Inc., 1986
  *
- * for larger values of n, 10 < n < 100 the geometric version by Devroye (1980) is used.
+ * for larger values of n with n*min(p, 1-p) < 30 the geometric version by Devroye (1980) is used.
  * Refrence:
  * Devroye, L. "Generating the maximum of independent identically distributed random variables", 
  * Computers & Mathematics with Applications, 1980, 6, 305 - 315
  *
- * For certain parameter regions, n > 20 and n*p < 0.05, the binomial distribution may be approximated by the
- * normal distribution N(n*p, sqrt(n*p*(1-p)))
+ * For n*min(p, 1-p) >= 30 the exact BTPE (triangle, parallelogram, exponential) rejection algorithm is used. Its
+ * expected number of iterations is bounded independently of n and p.
+ * Reference:
+ * Kachitvichyanukul, V. and Schmeiser, B. W., "Binomial Random Variate Generation", Communications of the ACM,
+ * 1988, 31, 216 - 222
+ *
+ * For p > 0.5 the count of failures is sampled and subtracted from n. The argument u2 is no longer used and only
+ * kept for compatibility.
  *
  ************************************************************************************************************/
 
@@ -199,6 +499,12 @@ uint32_t gammarnd64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, doub
 uint32_t geometricMethod32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, uint32_t *sample, float n, float p);
 uint32_t geometricMethod64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, int64_t *sample, double n, double p);
 
+/*
+ * BTPE by Kachitvichyanukul and Schmeiser (1988), for internal use only. Requires n*p >= 30 and p <= 0.5.
+ */
+uint32_t btpe32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, int32_t *sample, uint32_t n, float p);
+uint32_t btpe64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, int64_t *sample, uint64_t n, double p);
+
 /*
  * Binomial random samples
  */
@@ -210,31 +516,29 @@ uint32_t binomialrnd64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, i
 /*******************************************************************************************************************
  * Poisson random samples with mean lambda.
  *
- * For small values of lambda < 30 use the multiplicative method.
+ * For small values of lambda < 10 use the multiplicative method.
  * References:
  * Knuth, D. E., "Art of Computer Programming - Seminumerical Algorithms",
  * Addison-Wesley, 1997, Vol. 2
  *
  * Devroye, L., "Non-uniform Random Variate Generation", Springer-Verlag, New York, Inc., 1986
  *
- * If 30 < lambda <= 100 rejection sampling is used.
+ * For lambda >= 10 the exact transformed rejection method with squeeze (PTRS) is used. It needs about two uniforms
+ * per sample for any lambda. The argument u2 is no longer used and only kept for compatibility.
  * Reference:
- * Atkinson, A. C., "The Computer Generation of Poisson Random Variables", Journal of the Royal Statistical Society.
- * Series C (Applied Statistics), Blackwell Publishing for the Royal Statistical Society, 1979, 28, pp. 29-35
- *
- * For large values of lambda > 100 the Poisson distribution is approximated by the normal distribution  using the 
- * central limit theorem (CLT)
+ * Hoermann, W., "The transformed rejection method for generating Poisson random variables",
+ * Insurance: Mathematics and Economics, 1993, 12, pp. 39-45
  *******************************************************************************************************************/
 
-// internal only
+// internal only, log(N!) for N >= 0 by table lookup below 1024 and Stirling's series above
 float logFactorial32(float N);
 double logFactorial64(double N);
 
 uint32_t poissMultiply32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, float* sample, float lambda);
 uint32_t poissMultiply64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, double* sample, double lambda);
 
-uint32_t poissRejection32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, float* sample,float lambda); 
-uint32_t poissRejection64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, double* sample, double lambda);
+uint32_t poissPTRS32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, float* sample, float lambda);
+uint32_t poissPTRS64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, double* sample, double lambda);
 
 // this one should be used
 uint32_t poissrnd32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, float* sample, float* u2, float lambda);
@@ -249,6 +553,202 @@ uint32_t poissrnd64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, doub
 uint32_t betarnd32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, float *sample, float alpha, float beta);
 uint32_t betarnd64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, double *sample, double alpha, double beta);
 
+
+/*******************************************************************
+ * Prepared distributions
+ *
+ * distinit runs the parameter dependent set-up of a distribution
+ * once and keeps the constants in an rngdist handle, distrnd32/64
+ * and distfill32/64 then only do the per-sample work. Sampling does
+ * not modify the handle, so one handle may be shared by threads.
+ *
+ *   distribution        a         b
+ *   TINYRNG_EXP         lambda    -
+ *   TINYRNG_NORMAL      mu        sigma
+ *   TINYRNG_GAMMA       alpha     beta
+ *   TINYRNG_BETA        alpha     beta
+ *   TINYRNG_POISSON     lambda    -
+ *   TINYRNG_BINOMIAL    n         p
+ *
+ * The methods are those of the functions above, except that the
+ * normal and gamma samplers take their standard normal samples from
+ * the Ziggurat sampler. Poisson and binomial counts are returned as
+ * floating point numbers as by poissrnd. Unknown distributions and
+ * parameters out of range yield TINYRNG_INTERVAL_ERROR.
+ ******************************************************************/
+#define TINYRNG_EXP 1
+#define TINYRNG_NORMAL 2
+#define TINYRNG_GAMMA 3
+#define TINYRNG_BETA 4
+#define TINYRNG_POISSON 5
+#define TINYRNG_BINOMIAL 6
+
+// sampling methods, chosen by distinit and kept in rngdist.method
+#define TINYRNG_METHOD_EXP 1
+#define TINYRNG_METHOD_NORMAL 2
+#define TINYRNG_METHOD_GAMMA 3
+#define TINYRNG_METHOD_BETA 4
+#define TINYRNG_METHOD_MULTIPLY 5
+#define TINYRNG_METHOD_PTRS 6
+#define TINYRNG_METHOD_BERNOULLI 7
+#define TINYRNG_METHOD_GEOMETRIC 8
+#define TINYRNG_METHOD_BTPE 9
+
+typedef struct {
+    uint32_t distribution;
+    uint32_t method;
+    uint32_t flip;
+    union {
+        struct { double inv; } exp;
+        struct { double mu, sigma; } norm;
+        struct { double invalpha, d, c, beta; } gamma;
+        struct { double alpha, beta, s, lambda, u, ln4; } beta;
+        struct { double L; } multiply;
+        struct { double lambda, loglam, a, b, invalpha, vr; } ptrs;
+        struct { double n, p, c; } trials;
+        struct { double n, r, q, nrq, s, a, m, xm, xl, xr, c, laml, lamr, p1, p2, p3, p4; } btpe;
+    } par;
+} rngdist;
+
+uint32_t distinit(rngdist *d, uint32_t distribution, double a, double b);
+
+uint32_t distrnd32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, const rngdist *d, float *sample);
+uint32_t distrnd64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, const rngdist *d, double *sample);
+
+uint32_t distfill32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, const rngdist *d, float *samples, uint32_t n);
+uint32_t distfill64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, const rngdist *d, double *samples, uint32_t n);
+
+/*
+ * Batched rejection sampling of the prepared gamma, beta and Poisson
+ * (lambda >= 10, PTRS) distributions with one of the bulk generators.
+ * The proposals of up to 256 samples are drawn in bulk and tested side
+ * by side (AVX2 where available), the accepted ones are packed into
+ * samples and only the rejected ones are proposed again. The methods
+ * are those of distrnd, the gamma sampler takes its normal samples from
+ * normstdrnd32fill / normstdrnd64fill and log and exp are evaluated by
+ * polynomial kernels, so the samples differ from those of distfill.
+ * The 32-bit version tests gamma and beta proposals in single
+ * precision. Other distributions yield TINYRNG_INTERVAL_ERROR.
+ */
+uint32_t rejfill32(uint32_t (*un)(uint32_t *, uint32_t *, uint32_t), uint32_t *seeds, const rngdist *d, float *samples, uint32_t n);
+uint32_t rejfill64(uint32_t (*un)(uint32_t *, uint64_t *, uint32_t), uint32_t *seeds, const rngdist *d, double *samples, uint32_t n);
+
+
+/*******************************************************************
+ * Discrete distributions by the alias method
+ *
+ * aliasinit builds the alias table of k outcomes with probabilities
+ * proportional to weights in O(k). table must hold 2 * k words. Each
+ * sample then costs one 32-bit generator word and one table lookup,
+ * independent of k. The probabilities are resolved to 2^-32.
+ *
+ * Negative, infinite or NaN weights, an all-zero weight vector and
+ * k = 0 or k > 2^31 yield TINYRNG_INTERVAL_ERROR. aliasinit needs a
+ * temporary work array of k 64-bit words and returns
+ * TINYRNG_MEMORY_ERROR if it cannot be allocated.
+ *
+ * References:
+ * Walker, A. J., "An efficient method for generating discrete random
+ * variables with general distributions", ACM Trans. Math. Softw.,
+ * 1977, 3, 253-256
+ *
+ * Vose, M. D., "A linear algorithm for generating random numbers with
+ * a given distribution", IEEE Trans. Softw. Eng., 1991, 17, 972-975
+ ******************************************************************/
+uint32_t aliasinit(uint32_t *table, const double *weights, uint32_t k);
+
+uint32_t aliasrnd32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, const uint32_t *table, uint32_t k, uint32_t *sample);
+
+// bulk version, un is one of the bulk generators, e.g. xorshift32fill
+uint32_t aliasfill32(uint32_t (*un)(uint32_t *, uint32_t *, uint32_t), uint32_t *seeds, const uint32_t *table, uint32_t k, uint32_t *samples, uint32_t n);
+
+
+/*******************************************************************
+ * Uniform random integers on [0, n)
+ *
+ * boundedrnd32 / boundedrnd64 map a generator word to [0, n) by
+ * Lemire's multiply-shift method. The samples are exactly uniform, a
+ * word is rejected with a probability below n / 2^32 resp. n / 2^64
+ * and the division is only done for those rare words. n = 0 yields
+ * TINYRNG_INTERVAL_ERROR. The bulk versions take one of the bulk
+ * generators, e.g. boundedfill32(xorshift32fill, seeds, buf, count, n).
+ *
+ * Reference:
+ * Lemire, D., "Fast random integer generation in an interval", ACM
+ * Trans. Model. Comput. Simul., 2019, 29, 3:1-3:12
+ ******************************************************************/
+uint32_t boundedrnd32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, uint32_t *sample, uint32_t n);
+uint32_t boundedrnd64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, uint64_t *sample, uint64_t n);
+
+uint32_t boundedfill32(uint32_t (*un)(uint32_t *, uint32_t *, uint32_t), uint32_t *seeds, uint32_t *samples, uint32_t count, uint32_t n);
+uint32_t boundedfill64(uint32_t (*un)(uint32_t *, uint64_t *, uint32_t), uint32_t *seeds, uint64_t *samples, uint32_t count, uint64_t n);
+
+
+/*******************************************************************
+ * Sampling k out of n without replacement
+ *
+ * samplefloyd32 / samplefloyd64 write k distinct integers of [0, n)
+ * to samples by Floyd's algorithm. Every k-subset is equally likely,
+ * but the order within samples is not random. It takes k bounded
+ * integers and a hash table of 2 k to 4 k words, so it is meant for k
+ * small compared to n. k > n yields TINYRNG_INTERVAL_ERROR and
+ * TINYRNG_MEMORY_ERROR is returned if the table cannot be allocated.
+ *
+ * selectinit / selectnext64 select k of n records sequentially by
+ * Vitter's method D, e.g. to pick records while streaming through a
+ * large file. Each call returns the index of the next selected record
+ * in increasing order, the expected cost per call is O(1) independent
+ * of n and no memory beyond the rngselect state is needed. u is a
+ * 64-bit generator such as xorshift64. selectfill64 returns the next
+ * m indices at once. selectinit requires k <= n <= 2^53; calls beyond
+ * the k-th index, or m larger than the indices left, yield
+ * TINYRNG_INTERVAL_ERROR.
+ *
+ * References:
+ * Bentley, J. and Floyd, B., "Programming pearls: a sample of
+ * brilliance", Commun. ACM, 1987, 30, 754-757
+ *
+ * Vitter, J. S., "An efficient algorithm for sequential random
+ * sampling", ACM Trans. Math. Softw., 1987, 13, 58-67
+ ******************************************************************/
+typedef struct {
+    uint64_t k;        // records left to select
+    uint64_t n;        // records left
+    uint64_t next;     // index of the first record left
+    double vprime;     // carried over between method D steps
+} rngselect;
+
+uint32_t samplefloyd32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, uint32_t *samples, uint32_t k, uint32_t n);
+uint32_t samplefloyd64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, uint64_t *samples, uint64_t k, uint64_t n);
+
+uint32_t selectinit(rngselect *s, uint64_t k, uint64_t n);
+uint32_t selectnext64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, rngselect *s, uint64_t *index);
+uint32_t selectfill64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, rngselect *s, uint64_t *indices, uint32_t m);
+
+
+/*******************************************************************
+ * Parallel fill of large arrays
+ *
+ * parfill32/64 fill n samples on nthreads threads (0 for all online
+ * cores). The array is cut into blocks of TINYRNG_PAR_BLOCK samples
+ * and block b is generated from substream b of stream of s, so the
+ * result is bit-identical for any number of threads. d is a prepared
+ * distribution, see distinit, or NULL for uniform samples on [0, 1).
+ * The 32-bit version uses the 32-bit generator of s, the 64-bit
+ * version the 64-bit one, e.g. xorshift32 and xorshift64.
+ *
+ * With TINYRNG_KISS32 streams n must not exceed 2^20 blocks. As a
+ * KISS32 substream holds only 2^20 steps, which a block of most
+ * distributions exceeds, KISS32 streams are limited to uniform samples,
+ * d != NULL yields TINYRNG_INTERVAL_ERROR. Errors of the generation are
+ * returned, the first one if several occur, unknown generators of s
+ * yield TINYRNG_INTERVAL_ERROR.
+ ******************************************************************/
+#define TINYRNG_PAR_BLOCK 65536
+
+uint32_t parfill32(rngstreams *s, uint64_t stream, const rngdist *d, float *samples, uint64_t n, uint32_t nthreads);
+uint32_t parfill64(rngstreams *s, uint64_t stream, const rngdist *d, double *samples, uint64_t n, uint32_t nthreads);
+
 #endif
 
 
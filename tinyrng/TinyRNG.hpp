@@ -0,0 +1,452 @@
+#ifndef TINYRNG_HPP
+#define TINYRNG_HPP
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <iterator>
+#include <type_traits>
+
+// generators and basic transformations as static inline functions
+#ifndef TINYRNG_INLINE
+#define TINYRNG_INLINE
+#endif
+
+extern "C" {
+#include "TinyRNG.h"
+}
+
+/**************************************************************************
+ *  This file is part of TinyRNG. Copyright Guido Klingbeil (2013).
+ *
+ *  TinyRNG is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  TinyRNG is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with TinyRNG.  If not, see <http://www.gnu.org/licenses/>.
+ *************************************************************************/
+
+
+/*
+ * C++ interface.
+ *
+ * The engines satisfy UniformRandomBitGenerator, so they work with the
+ * <random> distributions and algorithms as well, e.g.
+ *
+ *   tinyrng::xorshift32_engine eng(42);
+ *   tinyrng::normal_distribution<double> norm(5.0, 2.0);
+ *   std::uniform_int_distribution<int> die(1, 6);
+ *   double x = norm(eng);
+ *   int d = die(eng);
+ *
+ * The distributions are templated on the engine and call the TinyRNG
+ * transformations with the generator of the engine. The generators,
+ * unifrnd, exprnd and normstdrnd are included in header-only mode, see
+ * TinyRNGinline.h, so these calls inline completely. gamma, beta,
+ * Poisson and binomial samples use prepared distributions, see distinit,
+ * from libtinyrng. float distributions take 32-bit generator words and
+ * the 32-bit transformations, double distributions 64-bit words and
+ * the 64-bit transformations, as the C interface does.
+ *
+ * If TinyRNG.h has been included without TINYRNG_INLINE before this
+ * header, everything works the same but nothing inlines.
+ */
+namespace tinyrng {
+
+namespace detail {
+
+// 32-bit words from the native 64-bit generators, the upper half is used
+inline uint32_t xorshift64wHigh(uint32_t *seeds, uint32_t *sample) {
+    uint64_t w = 0;
+    uint32_t _err = ::xorshift64w(seeds, &w);
+
+    *sample = (uint32_t)(w >> 32);
+    return(_err);
+}
+
+
+inline uint32_t kiss64wHigh(uint32_t *seeds, uint32_t *sample) {
+    uint64_t w = 0;
+    uint32_t _err = ::kiss64w(seeds, &w);
+
+    *sample = (uint32_t)(w >> 32);
+    return(_err);
+}
+
+
+/*
+ * Generator traits: result type, number of seed words, one step for
+ * 32-bit and 64-bit words, bulk fill, seeding and jump ahead.
+ */
+struct xorshift32_traits {
+    typedef uint32_t result_type;
+    static const uint32_t words = 5;
+    static const bool jumps = true;
+
+    static uint32_t next(uint32_t *s, uint32_t *x) { return(::xorshift32(s, x)); }
+    static uint32_t next32(uint32_t *s, uint32_t *x) { return(::xorshift32(s, x)); }
+    static uint32_t next64(uint32_t *s, uint64_t *x) { return(::xorshift64(s, x)); }
+    static uint32_t fill(uint32_t *s, uint32_t *x, uint32_t n) { return(::xorshift32fill(s, x, n)); }
+    static uint32_t seed(uint32_t *s) { return(::seed(s, 5)); }
+    static uint32_t seed(uint32_t *s, uint64_t v) { return(::seedfrom(s, 5, v)); }
+    static uint32_t jump(uint32_t *s, uint32_t k) { return(::xorshift32jump(s, k)); }
+};
+
+
+struct kiss32_traits {
+    typedef uint32_t result_type;
+    static const uint32_t words = 5;
+    static const bool jumps = true;
+
+    static uint32_t next(uint32_t *s, uint32_t *x) { return(::kiss32(s, x)); }
+    static uint32_t next32(uint32_t *s, uint32_t *x) { return(::kiss32(s, x)); }
+    static uint32_t next64(uint32_t *s, uint64_t *x) { return(::kiss64(s, x)); }
+    static uint32_t fill(uint32_t *s, uint32_t *x, uint32_t n) { return(::kiss32fill(s, x, n)); }
+    static uint32_t seed(uint32_t *s) { return(::seedkiss(s)); }
+    static uint32_t seed(uint32_t *s, uint64_t v) { return(::seedkissfrom(s, v)); }
+    static uint32_t jump(uint32_t *s, uint32_t k) { return(::kiss32jump(s, k)); }
+};
+
+
+struct xorshift64w_traits {
+    typedef uint64_t result_type;
+    static const uint32_t words = 4;
+    static const bool jumps = false;
+
+    static uint32_t next(uint32_t *s, uint64_t *x) { return(::xorshift64w(s, x)); }
+    static uint32_t next32(uint32_t *s, uint32_t *x) { return(xorshift64wHigh(s, x)); }
+    static uint32_t next64(uint32_t *s, uint64_t *x) { return(::xorshift64w(s, x)); }
+    static uint32_t fill(uint32_t *s, uint64_t *x, uint32_t n) { return(::xorshift64wfill(s, x, n)); }
+    static uint32_t seed(uint32_t *s) { return(::seedxorshift64w(s)); }
+    static uint32_t seed(uint32_t *s, uint64_t v) { return(::seedxorshift64wfrom(s, v)); }
+    static uint32_t jump(uint32_t *, uint32_t) { return(TINYRNG_INTERVAL_ERROR); }
+};
+
+
+struct kiss64w_traits {
+    typedef uint64_t result_type;
+    static const uint32_t words = 8;
+    static const bool jumps = false;
+
+    static uint32_t next(uint32_t *s, uint64_t *x) { return(::kiss64w(s, x)); }
+    static uint32_t next32(uint32_t *s, uint32_t *x) { return(kiss64wHigh(s, x)); }
+    static uint32_t next64(uint32_t *s, uint64_t *x) { return(::kiss64w(s, x)); }
+    static uint32_t fill(uint32_t *s, uint64_t *x, uint32_t n) { return(::kiss64wfill(s, x, n)); }
+    static uint32_t seed(uint32_t *s) { return(::seedkiss64w(s)); }
+    static uint32_t seed(uint32_t *s, uint64_t v) { return(::seedkiss64wfrom(s, v)); }
+    static uint32_t jump(uint32_t *, uint32_t) { return(TINYRNG_INTERVAL_ERROR); }
+};
+
+
+// the seed is the key, the stream starts at counter 0
+struct philox_traits {
+    typedef uint32_t result_type;
+    static const uint32_t words = TINYRNG_PHILOX_WORDS;
+    static const bool jumps = false;
+
+    static uint32_t next(uint32_t *s, uint32_t *x) { return(::philox32(s, x)); }
+    static uint32_t next32(uint32_t *s, uint32_t *x) { return(::philox32(s, x)); }
+    static uint32_t next64(uint32_t *s, uint64_t *x) { return(::philox64(s, x)); }
+    static uint32_t fill(uint32_t *s, uint32_t *x, uint32_t n) { return(::philox32fill(s, x, n)); }
+    static uint32_t seed(uint32_t *s, uint64_t v) { return(::seedphilox(s, v, 0)); }
+    static uint32_t jump(uint32_t *, uint32_t) { return(TINYRNG_INTERVAL_ERROR); }
+
+    static uint32_t seed(uint32_t *s) {
+        uint32_t k[2] = {0, 0};
+        uint32_t _err = ::getSeeds(k, 2);
+
+        ::seedphilox(s, ((uint64_t)k[0] << 32) | k[1], 0);
+        return(_err);
+    }
+};
+
+
+// steps below this are cheaper than a jump
+const unsigned long long JUMP_MIN = 4096;
+
+} // namespace detail
+
+
+/*
+ * Engine holding the seed array of one generator.
+ */
+template <class Traits>
+class engine {
+public:
+    typedef Traits traits_type;
+    typedef typename Traits::result_type result_type;
+
+    static constexpr result_type min() { return(0); }
+    static constexpr result_type max() { return((result_type)~(result_type)0); }
+
+    // seeded from the system entropy source
+    engine() { seed(); }
+
+    // seeded deterministically from one 64-bit value
+    explicit engine(uint64_t s) { seed(s); }
+
+    void seed() { Traits::seed(seeds_); }
+    void seed(uint64_t s) { Traits::seed(seeds_, s); }
+
+    result_type operator()() {
+        result_type x;
+
+        Traits::next(seeds_, &x);
+        return(x);
+    }
+
+    // advance by n words, by jumping ahead where the generator supports it
+    void discard(unsigned long long n) {
+        result_type x;
+        uint32_t b;
+
+        if(Traits::jumps && n >= detail::JUMP_MIN) {
+            for(b = 12; (n >> b) != 0; b++) {
+                if((n >> b) & 1) {
+                    Traits::jump(seeds_, b);
+                }
+            }
+            n &= detail::JUMP_MIN - 1;
+        }
+        for(; n > 0; n--) {
+            Traits::next(seeds_, &x);
+        }
+    }
+
+    // bulk generation, contiguous result_type ranges use the bulk generators
+    void generate(result_type *first, result_type *last) {
+        while(last - first > 0) {
+            uint32_t n = (last - first > 0x40000000) ? 0x40000000 : (uint32_t)(last - first);
+
+            Traits::fill(seeds_, first, n);
+            first += n;
+        }
+    }
+
+    template <class OutputIt>
+    void generate(OutputIt first, OutputIt last) {
+        for(; first != last; ++first) {
+            *first = (*this)();
+        }
+    }
+
+    // the C seed array, e.g. to call the transformations of TinyRNG.h
+    uint32_t *state() { return(seeds_); }
+    const uint32_t *state() const { return(seeds_); }
+
+    bool operator==(const engine &o) const { return(memcmp(seeds_, o.seeds_, sizeof(seeds_)) == 0); }
+    bool operator!=(const engine &o) const { return(!(*this == o)); }
+
+private:
+    uint32_t seeds_[Traits::words];
+};
+
+typedef engine<detail::xorshift32_traits> xorshift32_engine;
+typedef engine<detail::kiss32_traits> kiss32_engine;
+typedef engine<detail::xorshift64w_traits> xorshift64w_engine;
+typedef engine<detail::kiss64w_traits> kiss64w_engine;
+typedef engine<detail::philox_traits> philox_engine;
+
+
+namespace detail {
+
+// the 32-bit or 64-bit transformation of TinyRNG.h for float or double
+template <class Real> struct precision;
+
+template <> struct precision<float> {
+    template <class Engine>
+    static uint32_t unif(Engine &e, float *x) {
+        return(::unifrnd32(Engine::traits_type::next32, e.state(), x));
+    }
+
+    template <class Engine>
+    static uint32_t exp(Engine &e, float *x, float lambda) {
+        return(::exprnd32(Engine::traits_type::next32, e.state(), x, lambda));
+    }
+
+    template <class Engine>
+    static uint32_t normstd(Engine &e, float *x, float *u2) {
+        return(::normstdrnd32(Engine::traits_type::next32, e.state(), x, u2));
+    }
+
+    template <class Engine>
+    static uint32_t dist(Engine &e, const rngdist *d, float *x) {
+        return(::distrnd32(Engine::traits_type::next32, e.state(), d, x));
+    }
+};
+
+template <> struct precision<double> {
+    template <class Engine>
+    static uint32_t unif(Engine &e, double *x) {
+        return(::unifrnd64(Engine::traits_type::next64, e.state(), x));
+    }
+
+    template <class Engine>
+    static uint32_t exp(Engine &e, double *x, double lambda) {
+        return(::exprnd64(Engine::traits_type::next64, e.state(), x, lambda));
+    }
+
+    template <class Engine>
+    static uint32_t normstd(Engine &e, double *x, double *u2) {
+        return(::normstdrnd64(Engine::traits_type::next64, e.state(), x, u2));
+    }
+
+    template <class Engine>
+    static uint32_t dist(Engine &e, const rngdist *d, double *x) {
+        return(::distrnd64(Engine::traits_type::next64, e.state(), d, x));
+    }
+};
+
+
+// distribution over a prepared rngdist, the counts of Poisson and binomial are Real as well
+template <class Real, uint32_t Distribution>
+class prepared {
+public:
+    typedef Real result_type;
+
+    prepared(double a, double b) : a_(a), b_(b) { err_ = distinit(&d_, Distribution, a, b); }
+
+    void reset() { }
+
+    template <class Engine>
+    result_type operator()(Engine &e) {
+        Real x = 0;
+
+        precision<Real>::dist(e, &d_, &x);
+        return(x);
+    }
+
+    // TINYRNG_OK or the error of distinit for invalid parameters
+    uint32_t error() const { return(err_); }
+
+protected:
+    double a_, b_;
+
+private:
+    rngdist d_;
+    uint32_t err_;
+};
+
+} // namespace detail
+
+
+/*
+ * Distributions
+ */
+
+// uniform on [0, 1) like unifrnd32 / unifrnd64
+template <class Real = double>
+class uniform_distribution {
+public:
+    typedef Real result_type;
+
+    void reset() { }
+
+    template <class Engine>
+    result_type operator()(Engine &e) {
+        Real x;
+
+        detail::precision<Real>::unif(e, &x);
+        return(x);
+    }
+};
+
+
+// exponential with rate lambda like exprnd32 / exprnd64
+template <class Real = double>
+class exponential_distribution {
+public:
+    typedef Real result_type;
+
+    explicit exponential_distribution(Real lambda = 1) : lambda_(lambda) { }
+
+    void reset() { }
+    Real lambda() const { return(lambda_); }
+
+    template <class Engine>
+    result_type operator()(Engine &e) {
+        Real x;
+
+        detail::precision<Real>::exp(e, &x, lambda_);
+        return(x);
+    }
+
+private:
+    Real lambda_;
+};
+
+
+// normal by the Box-Muller transform, keeps the second sample of a pair like normrnd
+template <class Real = double>
+class normal_distribution {
+public:
+    typedef Real result_type;
+
+    explicit normal_distribution(Real mu = 0, Real sigma = 1) : mu_(mu), sigma_(sigma), u2_(NAN) { }
+
+    // drop the cached second sample
+    void reset() { u2_ = NAN; }
+    Real mean() const { return(mu_); }
+    Real stddev() const { return(sigma_); }
+
+    template <class Engine>
+    result_type operator()(Engine &e) {
+        Real x;
+
+        detail::precision<Real>::normstd(e, &x, &u2_);
+        return(mu_ + sigma_ * x);
+    }
+
+private:
+    Real mu_, sigma_, u2_;
+};
+
+
+template <class Real = double>
+class gamma_distribution : public detail::prepared<Real, TINYRNG_GAMMA> {
+public:
+    explicit gamma_distribution(double alpha = 1, double beta = 1) : detail::prepared<Real, TINYRNG_GAMMA>(alpha, beta) { }
+
+    double alpha() const { return(this->a_); }
+    double beta() const { return(this->b_); }
+};
+
+
+template <class Real = double>
+class beta_distribution : public detail::prepared<Real, TINYRNG_BETA> {
+public:
+    explicit beta_distribution(double alpha = 1, double beta = 1) : detail::prepared<Real, TINYRNG_BETA>(alpha, beta) { }
+
+    double alpha() const { return(this->a_); }
+    double beta() const { return(this->b_); }
+};
+
+
+template <class Real = double>
+class poisson_distribution : public detail::prepared<Real, TINYRNG_POISSON> {
+public:
+    explicit poisson_distribution(double lambda = 1) : detail::prepared<Real, TINYRNG_POISSON>(lambda, 0) { }
+
+    double mean() const { return(this->a_); }
+};
+
+
+template <class Real = double>
+class binomial_distribution : public detail::prepared<Real, TINYRNG_BINOMIAL> {
+public:
+    explicit binomial_distribution(double n = 1, double p = 0.5) : detail::prepared<Real, TINYRNG_BINOMIAL>(n, p) { }
+
+    double t() const { return(this->a_); }
+    double p() const { return(this->b_); }
+};
+
+} // namespace tinyrng
+
+#endif
@@ -0,0 +1,153 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+#include <TinyRNG.h>
+
+/**************************************************************************
+ *  This file is part of TinyRNG. Copyright Guido Klingbeil (2013).
+ *
+ *  TinyRNG is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  TinyRNG is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with TinyRNG.  If not, see <http://www.gnu.org/licenses/>.
+ *************************************************************************/
+
+
+/*
+ * Alias tables for discrete distributions.
+ *
+ * Column j of a table of k outcomes is the word pair
+ *   table[2 j]     threshold, the probability to keep j times 2^32
+ *   table[2 j + 1] alias, the outcome returned otherwise
+ * so a sample touches a single 8 byte entry. A generator word w picks
+ * the column j = (w k) >> 32 and the low 32 bits of the product w k,
+ * which are uniform within the column, are compared to the threshold.
+ *
+ * The table is built by Vose's method in 64-bit fixed point: every
+ * column holds 2^32, the scaled weights add up to exactly k 2^32, and
+ * instead of two work lists a small and a large scan pointer walk the
+ * weights once.
+ */
+
+#define ALIAS_FULL 4294967296ULL
+
+
+// next index from i on with a weight below / at least one column
+static uint32_t nextSmall(const uint64_t *w, uint32_t i, uint32_t k) {
+    while(i < k && w[i] >= ALIAS_FULL) i++;
+    return(i);
+}
+
+
+static uint32_t nextLarge(const uint64_t *w, uint32_t i, uint32_t k) {
+    while(i < k && w[i] < ALIAS_FULL) i++;
+    return(i);
+}
+
+
+uint32_t aliasinit(uint32_t *table, const double *weights, uint32_t k) {
+    uint64_t *w = NULL;
+    uint64_t total = 0, target = (uint64_t)k << 32;
+    double sum = 0.0, scale = 0.0;
+    uint32_t i = 0, big = 0, s = 0, l = 0, cur = 0;
+
+    if(k == 0 || k > 0x80000000U) return(TINYRNG_INTERVAL_ERROR);
+
+    for(i = 0; i < k; i++) {
+        if(!(weights[i] >= 0.0) || isinf(weights[i])) return(TINYRNG_INTERVAL_ERROR);
+        sum += weights[i];
+    }
+    if(!(sum > 0.0) || isinf(sum)) return(TINYRNG_INTERVAL_ERROR);
+
+    w = (uint64_t*)malloc(k * sizeof(uint64_t));
+    if(w == NULL) return(TINYRNG_MEMORY_ERROR);
+
+    // scale to k columns of 2^32 each, the rounding error goes to the largest weight
+    scale = (double)target / sum;
+    for(i = 0; i < k; i++) {
+        w[i] = (uint64_t)(weights[i] * scale + 0.5);
+        total += w[i];
+        if(w[i] > w[big]) big = i;
+    }
+    w[big] += target - total;
+
+    // fill every small column with its own weight and the rest from a large one
+    s = nextSmall(w, 0, k);
+    l = nextLarge(w, 0, k);
+    cur = s;
+    if(cur < k) s = nextSmall(w, cur + 1, k);
+
+    while(cur < k && l < k) {
+        table[2 * cur] = (uint32_t)w[cur];
+        table[2 * cur + 1] = l;
+        w[l] -= ALIAS_FULL - w[cur];
+
+        if(w[l] < ALIAS_FULL) {
+            // l became small, handle it now unless the small scan still has to pass it
+            if(l < s) {
+                cur = l;
+                l = nextLarge(w, l + 1, k);
+                continue;
+            }
+            l = nextLarge(w, l + 1, k);
+        }
+        cur = s;
+        if(cur < k) s = nextSmall(w, cur + 1, k);
+    }
+
+    // what is left is exactly full
+    for(; l < k; l = nextLarge(w, l + 1, k)) {
+        table[2 * l] = 0xFFFFFFFF;
+        table[2 * l + 1] = l;
+    }
+    while(cur < k) {
+        table[2 * cur] = 0xFFFFFFFF;
+        table[2 * cur + 1] = cur;
+        cur = s;
+        if(cur < k) s = nextSmall(w, cur + 1, k);
+    }
+
+    free(w);
+
+    return(TINYRNG_OK);
+}
+
+
+uint32_t aliasrnd32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, const uint32_t *table, uint32_t k, uint32_t *sample) {
+    uint32_t _err = 0;
+    uint32_t f = 0, j = 0;
+    uint64_t m = 0;
+
+    _err = u(seeds, &f);
+    m = (uint64_t)f * k;
+    j = (uint32_t)(m >> 32);
+    *sample = j ^ ((j ^ table[2 * j + 1]) & -(uint32_t)((uint32_t)m >= table[2 * j]));
+
+    return(_err);
+}
+
+
+uint32_t aliasfill32(uint32_t (*un)(uint32_t *, uint32_t *, uint32_t), uint32_t *seeds, const uint32_t *table, uint32_t k, uint32_t *samples, uint32_t n) {
+    uint32_t _err = 0;
+    uint32_t i = 0, j = 0;
+    uint64_t m = 0;
+
+    // draw all words first, then map them in place
+    _err = un(seeds, samples, n);
+    for(i = 0; i < n; i++) {
+        m = (uint64_t)samples[i] * k;
+        j = (uint32_t)(m >> 32);
+        // branch free select, the comparison is a coin flip for mixed columns
+        samples[i] = j ^ ((j ^ table[2 * j + 1]) & -(uint32_t)((uint32_t)m >= table[2 * j]));
+    }
+
+    return(_err);
+}
@@ -0,0 +1,297 @@
+#ifndef TINYRNGINLINE_H
+#define TINYRNGINLINE_H
+
+#include <stdint.h>
+#include <math.h>
+
+/**************************************************************************
+ *  This file is part of TinyRNG. Copyright Guido Klingbeil (2013).
+ *
+ *  TinyRNG is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  TinyRNG is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with TinyRNG.  If not, see <http://www.gnu.org/licenses/>.
+ *************************************************************************/
+
+
+/*
+ * Generators and basic transformations.
+ *
+ * This file holds the only copy of the scalar generators and of
+ * unifrnd, exprnd and normstdrnd. TinyRNG.c includes it with an empty
+ * TINYRNG_API to compile them into libtinyrng. A program that defines
+ * TINYRNG_INLINE before including TinyRNG.h gets them as static inline
+ * functions instead. A call like unifrnd32(xorshift32, seeds, &f) then
+ * has the generator known at compile time, so the compiler inlines
+ * the generator into the transformation and the transformation into
+ * the caller, and drops the error code, which is always zero.
+ */
+#ifndef TINYRNG_API
+#define TINYRNG_API static inline
+#endif
+
+#ifndef TWOPI32
+#define TWOPI32 6.283185307179586f
+#define TWOPI64 6.283185307179586
+#endif
+
+
+/*
+ * RNG itself. We generate 32-bit of randomness in each iteration.
+ * If 64-bits of randomness are required, we simple pad them together.
+ */
+
+// 32-bit XORSHIFT RNG
+// this RNG uses 5 seeds, change the number of seeds changes the structure of the RNG
+TINYRNG_API uint32_t xorshift32(uint32_t *seeds, uint32_t *sample) {
+	uint32_t t;
+
+	t = (seeds[0] ^ (seeds[0] >> 7));
+	seeds[0] = seeds[1];
+	seeds[1] = seeds[2];
+	seeds[2] = seeds[3];
+	seeds[3] = seeds[4];
+	seeds[4] = (seeds[4] ^ (seeds[4] << 6)) ^ (t ^ (t << 13));
+	*sample = (seeds[1] + seeds[1] + 1) * seeds[4];
+
+        return(0);
+}
+
+
+// this makes a rather unelegant appearence
+// I have to pass a pointer to the generator and
+// a second pointer to the seeds all the time
+
+// 64-bit wrapper
+// calls the 32-bit generator twice
+TINYRNG_API uint32_t xorshift64(uint32_t *seeds, uint64_t *sample) {
+     uint32_t _err = 0;
+     uint32_t f1 = 0, f2 = 0;
+
+     // generate 64-bits of randomness
+     _err = xorshift32(seeds, &f1);
+     _err = xorshift32(seeds, &f2);
+     
+     *sample = ((uint64_t)f1 << 32) + f2;
+     return(_err);
+}
+
+
+/*
+ * Marsaglia's KISS (Keep it simple, stupid) generators.
+ */
+TINYRNG_API uint32_t kiss32(uint32_t *seeds, uint32_t *sample) {
+    uint32_t t = 0;
+
+    seeds[1] ^= (seeds[1] << 5);
+    seeds[1] ^= (seeds[1] >> 7);
+    seeds[1] ^= (seeds[1] << 22);
+    t = seeds[2] + seeds[3] + seeds[4];
+    seeds[2] = seeds[3];
+    seeds[4] = t < 0;
+    seeds[4] = t & 2147483647;
+    seeds[0] += 1411392427;
+    *sample = seeds[0] + seeds[1] + seeds[3];
+
+    return(0);
+}
+
+
+TINYRNG_API uint32_t kiss64(uint32_t *seeds, uint64_t *sample) {
+     uint32_t _err = 0;
+     uint32_t f1 = 0, f2 = 0;
+
+     // generate 64-bits of randomness
+     _err = kiss32(seeds, &f1);
+     _err = kiss32(seeds, &f2);
+     
+     *sample = ((uint64_t)f1 << 32) + f2;
+     return(_err);
+}
+
+
+/*
+ * Native 64-bit generators. The 64-bit state words live in the
+ * uint32_t seed array, low word first.
+ */
+
+// xorshift128+, one 64-bit word per state update
+TINYRNG_API uint32_t xorshift64w(uint32_t *seeds, uint64_t *sample) {
+    uint64_t s0 = ((uint64_t)seeds[1] << 32) | seeds[0];
+    uint64_t s1 = ((uint64_t)seeds[3] << 32) | seeds[2];
+    uint64_t t = s0;
+
+    s0 = s1;
+    t ^= t << 23;
+    s1 = t ^ s0 ^ (t >> 18) ^ (s0 >> 5);
+    *sample = s1 + s0;
+
+    seeds[0] = (uint32_t)s0;
+    seeds[1] = (uint32_t)(s0 >> 32);
+    seeds[2] = (uint32_t)s1;
+    seeds[3] = (uint32_t)(s1 >> 32);
+
+    return(0);
+}
+
+
+// Marsaglia's 64-bit KISS: MWC + XORSHIFT + CNG
+TINYRNG_API uint32_t kiss64w(uint32_t *seeds, uint64_t *sample) {
+    uint64_t x = ((uint64_t)seeds[1] << 32) | seeds[0];
+    uint64_t c = ((uint64_t)seeds[3] << 32) | seeds[2];
+    uint64_t y = ((uint64_t)seeds[5] << 32) | seeds[4];
+    uint64_t z = ((uint64_t)seeds[7] << 32) | seeds[6];
+    uint64_t t;
+
+    // multiply with carry, multiplier 2^58 + 1
+    t = (x << 58) + c;
+    c = x >> 6;
+    x += t;
+    c += (x < t);
+
+    // XORSHIFT
+    y ^= y << 13;
+    y ^= y >> 17;
+    y ^= y << 43;
+
+    // congruential
+    z = 6906969069ULL * z + 1234567;
+
+    *sample = x + y + z;
+
+    seeds[0] = (uint32_t)x;
+    seeds[1] = (uint32_t)(x >> 32);
+    seeds[2] = (uint32_t)c;
+    seeds[3] = (uint32_t)(c >> 32);
+    seeds[4] = (uint32_t)y;
+    seeds[5] = (uint32_t)(y >> 32);
+    seeds[6] = (uint32_t)z;
+    seeds[7] = (uint32_t)(z >> 32);
+
+    return(0);
+}
+
+
+// uniform random sample on (0, 1]
+TINYRNG_API uint32_t unifrnd32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, float *sample) {
+    uint32_t _err = 0;    
+    uint32_t f1 = 0;
+    union { uint32_t i; float f; } f2;
+
+    _err = u(seeds, &f1);
+
+    // convert to float
+
+    // the fraction of a single precision floating point number is 23 bits
+    f1 = f1 >> 9;
+
+    // set the exponent to 127, since 2(127 - 127) = 1
+    f2.i = f1 | 0x3F800000;
+    *sample = f2.f - 1.0f;
+
+    return(_err);
+}
+
+
+TINYRNG_API uint32_t unifrnd64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, double *sample) {
+    uint32_t _err = 0;
+    uint64_t f1 = 0;
+    union { uint64_t i; double f; } f2;
+
+    // generate 64-bits of randomness
+    _err = u(seeds, &f1);
+
+    // convert to double
+
+    // the mantissa of normalised floating point values is always > 1
+    // so we have to shift it by 1.0
+    f1 = (f1 >> 12) | 0x3FF0000000000000ULL; /* Take upper 52 bits */
+    f2.i = f1; /* Make a double from bits */
+    *sample = f2.f - 1.0;
+
+    return(_err);
+}
+
+
+// 32-bit exponential random sample with mean lambda
+TINYRNG_API uint32_t exprnd32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, float *sample, float lambda) {
+    uint32_t _err = 0;
+    float f = 0.0f;
+
+    _err = unifrnd32(u, seeds, &f);
+
+    // unifrnd32 may return 0, 1 - f is in (0, 1]
+    *sample = -logf(1.0f - f) / lambda;
+
+    return(_err);
+}
+
+
+// 64-bit exponential random sample with mean lambda
+TINYRNG_API uint32_t exprnd64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, double *sample, double lambda) {
+    uint32_t _err = 0;
+    double f = 0.0;
+
+    _err = unifrnd64(u, seeds, &f);
+
+    *sample = -log(1.0 - f) / lambda;
+
+    return(_err);
+}
+
+
+// standard normal random sample
+// u2 to make the function re-entrant (thread safe)
+TINYRNG_API uint32_t normstdrnd32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, float *sample, float *u2) {
+    uint32_t _err = 0;
+    float r = 0.0f, phi = 0.0f, *ftmp;
+
+    if(isnan(*u2)) {
+        _err = unifrnd32(u, seeds, &r);
+        // unifrnd32 may return 0, 1 - r is in (0, 1]
+        r = sqrtf(-2.0f * logf(1.0f - r));
+        _err = unifrnd32(u, seeds, &phi);
+        phi *= TWOPI32;
+
+        *sample = r * cosf(phi);
+        *u2 = r * sinf(phi);
+    } else { 
+        *sample = *u2;
+        *u2 = NAN;
+    }
+    
+    return(_err);
+}
+
+
+// 64-bit standard normal random sample
+// u2 to make the function re-entrant (thread safe)
+TINYRNG_API uint32_t normstdrnd64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, double *sample, double *u2) {
+    uint32_t _err = 0;
+    double r = 0.0f, phi = 0.0f;
+      
+    if(isnan(*u2)) {
+        _err = unifrnd64(u, seeds, &r);
+        r = sqrt(-2.0 * log(1.0 - r));
+        _err = unifrnd64(u, seeds, &phi);
+        phi *= TWOPI64;
+
+        *sample = r * cos(phi);
+        *u2 = r * sin(phi);
+    } else {
+        *sample = *u2;
+        *u2 = NAN;
+    }
+    
+    return(_err);
+}
+
+#endif
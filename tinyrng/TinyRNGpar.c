@@ -0,0 +1,159 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <TinyRNG.h>
+
+/**************************************************************************
+ *  This file is part of TinyRNG. Copyright Guido Klingbeil (2013).
+ *
+ *  TinyRNG is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  TinyRNG is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with TinyRNG.  If not, see <http://www.gnu.org/licenses/>.
+ *************************************************************************/
+
+
+/*
+ * Parallel fill.
+ *
+ * The output is cut into blocks of TINYRNG_PAR_BLOCK samples, block b
+ * is filled from substream b of the given stream. The workers, the
+ * calling thread among them, take the next unfilled block from a shared
+ * counter until all are done. Which worker fills a block has no effect
+ * on its content, so the result only depends on the streams, the
+ * stream index and the distribution.
+ */
+
+typedef struct {
+    rngstreams *s;
+    uint64_t stream;
+    const rngdist *d;
+    void *samples;
+    uint64_t n;
+    uint64_t blocks;
+    uint64_t next;
+    uint32_t bits;
+    uint32_t err;
+} parjob;
+
+
+// fills block b, the seeds are the start of substream b
+static uint32_t parBlock(parjob *job, uint64_t b) {
+    uint32_t seeds[5];
+    uint64_t first = b * TINYRNG_PAR_BLOCK;
+    uint32_t n = (uint32_t)((job->n - first) < TINYRNG_PAR_BLOCK ? job->n - first : TINYRNG_PAR_BLOCK);
+    uint32_t _err = 0;
+
+    _err = substreamget(job->s, job->stream, b, seeds);
+    if(_err) return(_err);
+
+    if(job->bits == 32) {
+        float *x = (float *)job->samples + first;
+
+        if(job->d == NULL) {
+            _err = unifrnd32fill(job->s->generator == TINYRNG_XORSHIFT32 ? xorshift32fill : kiss32fill, seeds, x, n);
+        } else {
+            _err = distfill32(job->s->generator == TINYRNG_XORSHIFT32 ? xorshift32 : kiss32, seeds, job->d, x, n);
+        }
+    } else {
+        double *x = (double *)job->samples + first;
+
+        if(job->d == NULL) {
+            _err = unifrnd64fill(job->s->generator == TINYRNG_XORSHIFT32 ? xorshift64fill : kiss64fill, seeds, x, n);
+        } else {
+            _err = distfill64(job->s->generator == TINYRNG_XORSHIFT32 ? xorshift64 : kiss64, seeds, job->d, x, n);
+        }
+    }
+
+    return(_err);
+}
+
+
+static void *parWorker(void *arg) {
+    parjob *job = (parjob *)arg;
+    uint64_t b;
+    uint32_t _err;
+
+    while((b = __atomic_fetch_add(&job->next, 1, __ATOMIC_RELAXED)) < job->blocks) {
+        _err = parBlock(job, b);
+        if(_err) {
+            // keep the first error, the remaining blocks are still filled
+            uint32_t none = 0;
+            __atomic_compare_exchange_n(&job->err, &none, _err, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+        }
+    }
+
+    return(NULL);
+}
+
+
+static uint32_t parFill(rngstreams *s, uint64_t stream, const rngdist *d, void *samples, uint64_t n, uint32_t nthreads, uint32_t bits) {
+    parjob job;
+    pthread_t *ids = NULL;
+    uint32_t i = 0, started = 0;
+
+    if(s->generator != TINYRNG_XORSHIFT32 && s->generator != TINYRNG_KISS32) {
+        return(TINYRNG_INTERVAL_ERROR);
+    }
+
+    // a KISS32 substream holds 2^20 steps, enough for uniform blocks only
+    if(s->generator == TINYRNG_KISS32 && d != NULL) {
+        return(TINYRNG_INTERVAL_ERROR);
+    }
+
+    job.s = s;
+    job.stream = stream;
+    job.d = d;
+    job.samples = samples;
+    job.n = n;
+    job.blocks = (n + TINYRNG_PAR_BLOCK - 1) / TINYRNG_PAR_BLOCK;
+    job.next = 0;
+    job.bits = bits;
+    job.err = 0;
+
+    if(nthreads == 0) {
+        long c = sysconf(_SC_NPROCESSORS_ONLN);
+        nthreads = c > 0 ? (uint32_t)c : 1;
+    }
+    if(nthreads > job.blocks) {
+        nthreads = job.blocks > 0 ? (uint32_t)job.blocks : 1;
+    }
+
+    // if threads cannot be started, the others take over their blocks
+    if(nthreads > 1) {
+        ids = (pthread_t *)malloc((nthreads - 1) * sizeof(pthread_t));
+    }
+    if(ids != NULL) {
+        for(i = 0; i < nthreads - 1; i++) {
+            if(pthread_create(&ids[started], NULL, parWorker, &job) == 0) {
+                started++;
+            }
+        }
+    }
+    parWorker(&job);
+    for(i = 0; i < started; i++) {
+        pthread_join(ids[i], NULL);
+    }
+    free(ids);
+
+    return(job.err);
+}
+
+
+uint32_t parfill32(rngstreams *s, uint64_t stream, const rngdist *d, float *samples, uint64_t n, uint32_t nthreads) {
+    return(parFill(s, stream, d, samples, n, nthreads, 32));
+}
+
+
+uint32_t parfill64(rngstreams *s, uint64_t stream, const rngdist *d, double *samples, uint64_t n, uint32_t nthreads) {
+    return(parFill(s, stream, d, samples, n, nthreads, 64));
+}
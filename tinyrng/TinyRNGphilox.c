@@ -0,0 +1,276 @@
+#include <stdint.h>
+#include <TinyRNG.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define TINYRNG_X86 1
+#include <immintrin.h>
+#endif
+
+/**************************************************************************
+ *  This file is part of TinyRNG. Copyright Guido Klingbeil (2013).
+ *
+ *  TinyRNG is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  TinyRNG is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with TinyRNG.  If not, see <http://www.gnu.org/licenses/>.
+ *************************************************************************/
+
+
+/*
+ * Philox4x32-10.
+ *
+ * One block is 10 rounds over the 4 counter words. A round multiplies
+ * two of the words by fixed constants, the high halves of the 64-bit
+ * products are mixed with the other two words and the key, the low
+ * halves are passed on. The key is bumped by the Weyl constants between
+ * the rounds. Blocks of consecutive counters are independent, so the
+ * AVX2 kernel computes 8 of them side by side, one block per lane, and
+ * transposes the result to the order of the scalar kernel.
+ */
+
+#define PHILOX_M0 0xD2511F53U
+#define PHILOX_M1 0xCD9E8D57U
+#define PHILOX_W0 0x9E3779B9U
+#define PHILOX_W1 0xBB67AE85U
+#define PHILOX_ROUNDS 10
+
+// layout of the seed array, see TinyRNG.h
+#define PHILOX_KEY 0
+#define PHILOX_CTR 2
+#define PHILOX_LEFT 6
+#define PHILOX_BUF 7
+
+
+static void philoxBlock(uint32_t k0, uint32_t k1, const uint32_t *ctr, uint32_t *out) {
+    uint32_t c0 = ctr[0], c1 = ctr[1], c2 = ctr[2], c3 = ctr[3];
+    uint64_t p0, p1;
+    uint32_t r;
+
+    for(r = 0; r < PHILOX_ROUNDS; r++) {
+        p0 = (uint64_t)PHILOX_M0 * c0;
+        p1 = (uint64_t)PHILOX_M1 * c2;
+        c0 = (uint32_t)(p1 >> 32) ^ c1 ^ k0;
+        c1 = (uint32_t)p1;
+        c2 = (uint32_t)(p0 >> 32) ^ c3 ^ k1;
+        c3 = (uint32_t)p0;
+        k0 += PHILOX_W0;
+        k1 += PHILOX_W1;
+    }
+
+    out[0] = c0;
+    out[1] = c1;
+    out[2] = c2;
+    out[3] = c3;
+}
+
+
+// 128-bit counter increment by n, n < 2^32
+static void philoxAdvance(uint32_t *ctr, uint32_t n) {
+    uint32_t w;
+
+    ctr[0] += n;
+    if(ctr[0] >= n) return;
+    for(w = 1; w < 4; w++) {
+        if(++ctr[w] != 0) return;
+    }
+}
+
+
+// nb consecutive blocks, the low counter word must not wrap within them
+static void philoxBlocksScalar(uint32_t k0, uint32_t k1, const uint32_t *ctr, uint32_t *out, uint32_t nb) {
+    uint32_t c[4] = {ctr[0], ctr[1], ctr[2], ctr[3]};
+    uint32_t b;
+
+    for(b = 0; b < nb; b++) {
+        philoxBlock(k0, k1, c, out + 4 * b);
+        c[0]++;
+    }
+}
+
+
+#ifdef TINYRNG_X86
+
+// high and low 32 bits of the 8 products a * m
+__attribute__((target("avx2")))
+static inline void philoxMul(__m256i a, __m256i m, __m256i *hi, __m256i *lo) {
+    __m256i even = _mm256_mul_epu32(a, m);
+    __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), m);
+
+    *lo = _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+    *hi = _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xAA);
+}
+
+
+__attribute__((target("avx2")))
+static void philoxBlocksAVX2(uint32_t k0, uint32_t k1, const uint32_t *ctr, uint32_t *out, uint32_t nb) {
+    const __m256i m0 = _mm256_set1_epi32((int)PHILOX_M0), m1 = _mm256_set1_epi32((int)PHILOX_M1);
+    const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i c0, c1, c2, c3, h0, l0, h1, l1, key0, key1;
+    __m256i t0, t1, t2, t3, u0, u1, u2, u3;
+    uint32_t b, r;
+
+    for(b = 0; b + 8 <= nb; b += 8) {
+        c0 = _mm256_add_epi32(_mm256_set1_epi32((int)(ctr[0] + b)), lane);
+        c1 = _mm256_set1_epi32((int)ctr[1]);
+        c2 = _mm256_set1_epi32((int)ctr[2]);
+        c3 = _mm256_set1_epi32((int)ctr[3]);
+        key0 = _mm256_set1_epi32((int)k0);
+        key1 = _mm256_set1_epi32((int)k1);
+
+        for(r = 0; r < PHILOX_ROUNDS; r++) {
+            philoxMul(c0, m0, &h0, &l0);
+            philoxMul(c2, m1, &h1, &l1);
+            c0 = _mm256_xor_si256(_mm256_xor_si256(h1, c1), key0);
+            c1 = l1;
+            c2 = _mm256_xor_si256(_mm256_xor_si256(h0, c3), key1);
+            c3 = l0;
+            key0 = _mm256_add_epi32(key0, _mm256_set1_epi32((int)PHILOX_W0));
+            key1 = _mm256_add_epi32(key1, _mm256_set1_epi32((int)PHILOX_W1));
+        }
+
+        // 4 words of 8 blocks to 8 consecutive blocks of 4 words
+        t0 = _mm256_unpacklo_epi32(c0, c1);
+        t1 = _mm256_unpackhi_epi32(c0, c1);
+        t2 = _mm256_unpacklo_epi32(c2, c3);
+        t3 = _mm256_unpackhi_epi32(c2, c3);
+        u0 = _mm256_unpacklo_epi64(t0, t2);
+        u1 = _mm256_unpackhi_epi64(t0, t2);
+        u2 = _mm256_unpacklo_epi64(t1, t3);
+        u3 = _mm256_unpackhi_epi64(t1, t3);
+        _mm256_storeu_si256((__m256i *)(out + 4 * b), _mm256_permute2x128_si256(u0, u1, 0x20));
+        _mm256_storeu_si256((__m256i *)(out + 4 * b + 8), _mm256_permute2x128_si256(u2, u3, 0x20));
+        _mm256_storeu_si256((__m256i *)(out + 4 * b + 16), _mm256_permute2x128_si256(u0, u1, 0x31));
+        _mm256_storeu_si256((__m256i *)(out + 4 * b + 24), _mm256_permute2x128_si256(u2, u3, 0x31));
+    }
+
+    if(b < nb) {
+        uint32_t c[4] = {ctr[0] + b, ctr[1], ctr[2], ctr[3]};
+
+        philoxBlocksScalar(k0, k1, c, out + 4 * b, nb - b);
+    }
+}
+
+#endif
+
+
+static void philoxBlocks(uint32_t k0, uint32_t k1, const uint32_t *ctr, uint32_t *out, uint32_t nb) {
+#ifdef TINYRNG_X86
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2")) {
+        philoxBlocksAVX2(k0, k1, ctr, out, nb);
+        return;
+    }
+#endif
+    philoxBlocksScalar(k0, k1, ctr, out, nb);
+}
+
+
+uint32_t philox4x32(const uint32_t *key, const uint32_t *counter, uint32_t *out) {
+    philoxBlock(key[0], key[1], counter, out);
+    return(TINYRNG_OK);
+}
+
+
+uint32_t seedphilox(uint32_t *seeds, uint64_t key, uint64_t i) {
+    uint64_t block = i >> 2;
+
+    seeds[PHILOX_KEY] = (uint32_t)key;
+    seeds[PHILOX_KEY + 1] = (uint32_t)(key >> 32);
+    seeds[PHILOX_CTR] = (uint32_t)block;
+    seeds[PHILOX_CTR + 1] = (uint32_t)(block >> 32);
+    seeds[PHILOX_CTR + 2] = 0;
+    seeds[PHILOX_CTR + 3] = 0;
+    seeds[PHILOX_LEFT] = 0;
+
+    // part of the block is used already
+    if(i & 3) {
+        philoxBlock(seeds[PHILOX_KEY], seeds[PHILOX_KEY + 1], seeds + PHILOX_CTR, seeds + PHILOX_BUF);
+        philoxAdvance(seeds + PHILOX_CTR, 1);
+        seeds[PHILOX_LEFT] = 4 - (uint32_t)(i & 3);
+    }
+
+    return(TINYRNG_OK);
+}
+
+
+uint32_t philox32(uint32_t *seeds, uint32_t *sample) {
+    if(seeds[PHILOX_LEFT] == 0) {
+        philoxBlock(seeds[PHILOX_KEY], seeds[PHILOX_KEY + 1], seeds + PHILOX_CTR, seeds + PHILOX_BUF);
+        philoxAdvance(seeds + PHILOX_CTR, 1);
+        seeds[PHILOX_LEFT] = 4;
+    }
+
+    *sample = seeds[PHILOX_BUF + 4 - seeds[PHILOX_LEFT]];
+    seeds[PHILOX_LEFT]--;
+
+    return(TINYRNG_OK);
+}
+
+
+// 64-bit sample from two consecutive words, first word high as xorshift64
+uint32_t philox64(uint32_t *seeds, uint64_t *sample) {
+    uint32_t f1 = 0, f2 = 0;
+
+    philox32(seeds, &f1);
+    philox32(seeds, &f2);
+    *sample = ((uint64_t)f1 << 32) + f2;
+
+    return(TINYRNG_OK);
+}
+
+
+uint32_t philox32fill(uint32_t *seeds, uint32_t *samples, uint32_t n) {
+    uint32_t i = 0, nb;
+
+    // words left over in the buffer
+    while(i < n && seeds[PHILOX_LEFT] > 0) {
+        philox32(seeds, samples + i);
+        i++;
+    }
+
+    // whole blocks straight into samples, split where the low counter word wraps
+    while(n - i >= 4) {
+        nb = (n - i) / 4;
+        if(seeds[PHILOX_CTR] != 0 && nb > 0U - seeds[PHILOX_CTR]) {
+            nb = 0U - seeds[PHILOX_CTR];
+        }
+        philoxBlocks(seeds[PHILOX_KEY], seeds[PHILOX_KEY + 1], seeds + PHILOX_CTR, samples + i, nb);
+        philoxAdvance(seeds + PHILOX_CTR, nb);
+        i += 4 * nb;
+    }
+
+    while(i < n) {
+        philox32(seeds, samples + i);
+        i++;
+    }
+
+    return(TINYRNG_OK);
+}
+
+
+// the words of up to PHILOX_PAIRS samples at a time, paired as philox64
+#define PHILOX_PAIRS 512
+
+uint32_t philox64fill(uint32_t *seeds, uint64_t *samples, uint32_t n) {
+    uint32_t w[2 * PHILOX_PAIRS];
+    uint32_t i, j, m;
+    uint32_t _err = 0;
+
+    for(i = 0; i < n; i += m) {
+        m = n - i < PHILOX_PAIRS ? n - i : PHILOX_PAIRS;
+        _err |= philox32fill(seeds, w, 2 * m);
+        for(j = 0; j < m; j++) {
+            samples[i + j] = ((uint64_t)w[2 * j] << 32) + w[2 * j + 1];
+        }
+    }
+
+    return(_err);
+}
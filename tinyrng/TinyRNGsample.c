@@ -0,0 +1,409 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+#include <TinyRNG.h>
+
+/**************************************************************************
+ *  This file is part of TinyRNG. Copyright Guido Klingbeil (2013).
+ *
+ *  TinyRNG is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  TinyRNG is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with TinyRNG.  If not, see <http://www.gnu.org/licenses/>.
+ *************************************************************************/
+
+
+/*
+ * Bounded integers by Lemire's multiply-shift method.
+ *
+ * A generator word x maps to the high half of the product x n, which
+ * lies in [0, n). Each value of the high half is hit by floor(2^w / n)
+ * or one more words x, the surplus words are those whose low half of
+ * the product is below 2^w mod n. Only when the low half is below n at
+ * all, 2^w mod n = (-n) mod n is computed and the word is rejected if
+ * its low half falls below it. So the division is skipped with
+ * probability 1 - n / 2^w, and a word is rejected with a probability
+ * below n / 2^w.
+ */
+
+// high and low 64 bits of the 128-bit product a b
+static inline uint64_t mulHigh64(uint64_t a, uint64_t b, uint64_t *lo) {
+#ifdef __SIZEOF_INT128__
+    unsigned __int128 m = (unsigned __int128)a * b;
+
+    *lo = (uint64_t)m;
+    return((uint64_t)(m >> 64));
+#else
+    uint64_t a0 = (uint32_t)a, a1 = a >> 32, b0 = (uint32_t)b, b1 = b >> 32;
+    uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+    uint64_t mid = (p00 >> 32) + (uint32_t)p01 + (uint32_t)p10;
+
+    *lo = (mid << 32) | (uint32_t)p00;
+    return(p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32));
+#endif
+}
+
+
+uint32_t boundedrnd32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, uint32_t *sample, uint32_t n) {
+    uint32_t _err = 0;
+    uint32_t x = 0, t = 0;
+    uint64_t m = 0;
+
+    if(n == 0) return(TINYRNG_INTERVAL_ERROR);
+
+    _err = u(seeds, &x);
+    m = (uint64_t)x * n;
+    if((uint32_t)m < n) {
+        t = (0U - n) % n;
+        while((uint32_t)m < t) {
+            _err = u(seeds, &x);
+            m = (uint64_t)x * n;
+        }
+    }
+    *sample = (uint32_t)(m >> 32);
+
+    return(_err);
+}
+
+
+uint32_t boundedrnd64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, uint64_t *sample, uint64_t n) {
+    uint32_t _err = 0;
+    uint64_t x = 0, t = 0, hi = 0, lo = 0;
+
+    if(n == 0) return(TINYRNG_INTERVAL_ERROR);
+
+    _err = u(seeds, &x);
+    hi = mulHigh64(x, n, &lo);
+    if(lo < n) {
+        t = (0ULL - n) % n;
+        while(lo < t) {
+            _err = u(seeds, &x);
+            hi = mulHigh64(x, n, &lo);
+        }
+    }
+    *sample = hi;
+
+    return(_err);
+}
+
+
+/*
+ * The bulk versions draw all words into samples first and map them in
+ * place. A rejected word is replaced by single words from un, so the
+ * samples are those of boundedrnd32 / boundedrnd64 on the same stream
+ * as long as nothing is rejected.
+ */
+uint32_t boundedfill32(uint32_t (*un)(uint32_t *, uint32_t *, uint32_t), uint32_t *seeds, uint32_t *samples, uint32_t count, uint32_t n) {
+    uint32_t _err = 0;
+    uint32_t i = 0, x = 0, t = 0;
+    uint64_t m = 0;
+
+    if(n == 0) return(TINYRNG_INTERVAL_ERROR);
+
+    _err = un(seeds, samples, count);
+    t = (0U - n) % n;
+    for(i = 0; i < count; i++) {
+        m = (uint64_t)samples[i] * n;
+        while((uint32_t)m < t) {
+            _err = un(seeds, &x, 1);
+            m = (uint64_t)x * n;
+        }
+        samples[i] = (uint32_t)(m >> 32);
+    }
+
+    return(_err);
+}
+
+
+uint32_t boundedfill64(uint32_t (*un)(uint32_t *, uint64_t *, uint32_t), uint32_t *seeds, uint64_t *samples, uint32_t count, uint64_t n) {
+    uint32_t _err = 0;
+    uint32_t i = 0;
+    uint64_t x = 0, t = 0, lo = 0;
+
+    if(n == 0) return(TINYRNG_INTERVAL_ERROR);
+
+    _err = un(seeds, samples, count);
+    t = (0ULL - n) % n;
+    for(i = 0; i < count; i++) {
+        samples[i] = mulHigh64(samples[i], n, &lo);
+        while(lo < t) {
+            _err = un(seeds, &x, 1);
+            samples[i] = mulHigh64(x, n, &lo);
+        }
+    }
+
+    return(_err);
+}
+
+
+/*
+ * Floyd's sampling of k out of n.
+ *
+ * For j = n - k .. n - 1 a value t is drawn from [0, j]. If t was taken
+ * before, j is taken instead, which cannot have been taken as all
+ * earlier values are below j. Every k-subset comes out with the same
+ * probability after k draws. The taken values are kept in an open
+ * addressing hash table of at least 2 k slots which stores value + 1,
+ * so an empty slot is 0. n < 2^32 resp. 2^64 leaves room for the + 1.
+ */
+
+#define FLOYD_MIN_SLOTS 16
+
+// Fibonacci hashing, shift = 64 - log2(slots)
+static inline uint64_t floydSlot(uint64_t v, uint32_t shift) {
+    return((v * 0x9E3779B97F4A7C15ULL) >> shift);
+}
+
+
+static uint32_t floydSlots(uint64_t k, uint64_t *slots, uint32_t *shift) {
+    if(k > SIZE_MAX / (4 * sizeof(uint64_t))) return(TINYRNG_MEMORY_ERROR);
+
+    *slots = FLOYD_MIN_SLOTS;
+    *shift = 60;
+    while(*slots < 2 * k) {
+        *slots <<= 1;
+        (*shift)--;
+    }
+    return(TINYRNG_OK);
+}
+
+
+uint32_t samplefloyd32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, uint32_t *samples, uint32_t k, uint32_t n) {
+    uint32_t *set = NULL;
+    uint64_t slots = 0, h = 0;
+    uint32_t _err = 0;
+    uint32_t i = 0, j = 0, t = 0, shift = 0;
+
+    if(k > n) return(TINYRNG_INTERVAL_ERROR);
+    if(k == 0) return(TINYRNG_OK);
+
+    if(floydSlots(k, &slots, &shift)) return(TINYRNG_MEMORY_ERROR);
+    set = (uint32_t*)calloc(slots, sizeof(uint32_t));
+    if(set == NULL) return(TINYRNG_MEMORY_ERROR);
+
+    for(j = n - k; j < n; j++) {
+        _err = boundedrnd32(u, seeds, &t, j + 1);
+
+        // look t up, j is new in any case
+        h = floydSlot(t, shift);
+        while(set[h] != 0 && set[h] != t + 1) {
+            h = (h + 1) & (slots - 1);
+        }
+        if(set[h] != 0) {
+            t = j;
+            h = floydSlot(t, shift);
+            while(set[h] != 0) {
+                h = (h + 1) & (slots - 1);
+            }
+        }
+        set[h] = t + 1;
+        samples[i++] = t;
+    }
+
+    free(set);
+    return(_err);
+}
+
+
+uint32_t samplefloyd64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, uint64_t *samples, uint64_t k, uint64_t n) {
+    uint64_t *set = NULL;
+    uint64_t slots = 0, h = 0, i = 0, j = 0, t = 0;
+    uint32_t _err = 0;
+    uint32_t shift = 0;
+
+    if(k > n) return(TINYRNG_INTERVAL_ERROR);
+    if(k == 0) return(TINYRNG_OK);
+
+    if(floydSlots(k, &slots, &shift)) return(TINYRNG_MEMORY_ERROR);
+    set = (uint64_t*)calloc(slots, sizeof(uint64_t));
+    if(set == NULL) return(TINYRNG_MEMORY_ERROR);
+
+    for(j = n - k; j < n; j++) {
+        _err = boundedrnd64(u, seeds, &t, j + 1);
+
+        h = floydSlot(t, shift);
+        while(set[h] != 0 && set[h] != t + 1) {
+            h = (h + 1) & (slots - 1);
+        }
+        if(set[h] != 0) {
+            t = j;
+            h = floydSlot(t, shift);
+            while(set[h] != 0) {
+                h = (h + 1) & (slots - 1);
+            }
+        }
+        set[h] = t + 1;
+        samples[i++] = t;
+    }
+
+    free(set);
+    return(_err);
+}
+
+
+/*
+ * Sequential sampling by Vitter's method D.
+ *
+ * selectnext64 draws the number S of records skipped before the next
+ * selected one out of the n records left, given that k of them are to
+ * be selected. Method D draws S by rejection from a continuous proposal
+ * with the expected cost of O(1) per selected record, where method A
+ * walks the skipped records one by one. Method D is used as long as
+ * k is small compared to the records left, alpha = 1 / 13, the rest is
+ * done by method A. The variable names follow Vitter's paper:
+ * vprime is the uniform variate carried over from the previous step,
+ * qu1 the number of possible skips n - k + 1. The uniform variates are
+ * on (0, 1], so their log is finite.
+ */
+
+#define SELECT_ALPHA_INV 13
+
+
+// uniform variate on (0, 1] with 53 bits
+static inline uint32_t selectUniform(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, double *f) {
+    uint64_t x = 0;
+    uint32_t _err = 0;
+
+    _err = u(seeds, &x);
+    *f = ((x >> 11) + 1) * 0x1.0p-53;
+    return(_err);
+}
+
+
+// skip by method A, k > 1
+static uint32_t selectSkipA(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, uint64_t k, uint64_t n, uint64_t *skip) {
+    double v = 0.0, quot = 0.0, top = (double)(n - k), nreal = (double)n;
+    uint64_t s = 0;
+    uint32_t _err = 0;
+
+    _err = selectUniform(u, seeds, &v);
+    quot = top / nreal;
+    while(quot > v) {
+        s++;
+        top -= 1.0;
+        nreal -= 1.0;
+        quot = quot * top / nreal;
+    }
+    *skip = s;
+
+    return(_err);
+}
+
+
+// skip by method D, k > 1 and SELECT_ALPHA_INV k < n
+static uint32_t selectSkipD(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, uint64_t k, uint64_t n, double *vprime, uint64_t *skip) {
+    double nreal = (double)n, kreal = (double)k;
+    double kinv = 1.0 / kreal, kmin1inv = 1.0 / (kreal - 1.0);
+    double qu1real = nreal - kreal + 1.0;
+    double x = 0.0, f = 0.0, y1 = 0.0, y2 = 0.0, top = 0.0, bottom = 0.0;
+    uint64_t qu1 = n - k + 1, s = 0, limit = 0, t = 0;
+    uint32_t _err = 0;
+
+    if(isnan(*vprime)) {
+        _err = selectUniform(u, seeds, &f);
+        *vprime = exp(log(f) * kinv);
+    }
+
+    while(1) {
+        // proposal, a continuous skip x below qu1
+        while(1) {
+            x = nreal * (1.0 - *vprime);
+            s = (uint64_t)x;
+            if(s < qu1) break;
+            _err = selectUniform(u, seeds, &f);
+            *vprime = exp(log(f) * kinv);
+        }
+
+        // squeeze, vprime is carried over to the next step if accepted
+        _err = selectUniform(u, seeds, &f);
+        y1 = exp(log(f * nreal / qu1real) * kmin1inv);
+        *vprime = y1 * (1.0 - x / nreal) * (qu1real / (qu1real - (double)s));
+        if(*vprime <= 1.0) break;
+
+        // the exact acceptance test
+        y2 = 1.0;
+        top = nreal - 1.0;
+        if(k - 1 > s) {
+            bottom = nreal - kreal;
+            limit = n - s;
+        } else {
+            bottom = nreal - (double)s - 1.0;
+            limit = qu1;
+        }
+        for(t = n - 1; t >= limit; t--) {
+            y2 = (y2 * top) / bottom;
+            top -= 1.0;
+            bottom -= 1.0;
+        }
+        if(nreal / (nreal - x) >= y1 * exp(log(y2) * kmin1inv)) {
+            _err = selectUniform(u, seeds, &f);
+            *vprime = exp(log(f) * kmin1inv);
+            break;
+        }
+        _err = selectUniform(u, seeds, &f);
+        *vprime = exp(log(f) * kinv);
+    }
+    *skip = s;
+
+    return(_err);
+}
+
+
+uint32_t selectinit(rngselect *s, uint64_t k, uint64_t n) {
+    if(k > n || n > (1ULL << 53)) return(TINYRNG_INTERVAL_ERROR);
+
+    s->k = k;
+    s->n = n;
+    s->next = 0;
+    s->vprime = NAN;
+
+    return(TINYRNG_OK);
+}
+
+
+uint32_t selectnext64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, rngselect *s, uint64_t *index) {
+    uint64_t skip = 0;
+    uint32_t _err = 0;
+
+    if(s->k == 0) return(TINYRNG_INTERVAL_ERROR);
+
+    // vprime is only valid from one method D step to the next
+    if(s->k > 1 && SELECT_ALPHA_INV * s->k < s->n) {
+        _err = selectSkipD(u, seeds, s->k, s->n, &s->vprime, &skip);
+    } else if(s->k > 1) {
+        _err = selectSkipA(u, seeds, s->k, s->n, &skip);
+        s->vprime = NAN;
+    } else {
+        _err = boundedrnd64(u, seeds, &skip, s->n);
+        s->vprime = NAN;
+    }
+
+    *index = s->next + skip;
+    s->next += skip + 1;
+    s->n -= skip + 1;
+    s->k--;
+
+    return(_err);
+}
+
+
+uint32_t selectfill64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, rngselect *s, uint64_t *indices, uint32_t m) {
+    uint32_t i = 0;
+    uint32_t _err = 0;
+
+    if(m > s->k) return(TINYRNG_INTERVAL_ERROR);
+
+    for(i = 0; i < m; i++) {
+        _err = selectnext64(u, seeds, s, indices + i);
+    }
+
+    return(_err);
+}
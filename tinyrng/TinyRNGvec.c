@@ -0,0 +1,1367 @@
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <TinyRNG.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define TINYRNG_X86 1
+#include <immintrin.h>
+#endif
+
+/**************************************************************************
+ *  This file is part of TinyRNG. Copyright Guido Klingbeil (2013).
+ *
+ *  TinyRNG is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  TinyRNG is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with TinyRNG.  If not, see <http://www.gnu.org/licenses/>.
+ *************************************************************************/
+
+
+/*
+ * Multi-lane XORSHIFT engine.
+ *
+ * TINYRNG_VEC_LANES independent copies of xorshift32 run side by side.
+ * The seed array is interleaved, seeds[w * TINYRNG_VEC_LANES + l] is state
+ * word w of lane l, so one state word of all lanes is a contiguous vector.
+ * Each step produces one word per lane, lane 0 first. The lane count is
+ * fixed, so the scalar, SSE2, AVX2 and AVX-512 kernels produce exactly the
+ * same stream and only differ in how many lanes they update per instruction.
+ */
+
+#define L TINYRNG_VEC_LANES
+
+
+// portable kernel, the inner loop over the lanes is easy to auto-vectorise
+static void xorshift32vecScalar(uint32_t *seeds, uint32_t *samples, uint32_t steps) {
+    uint32_t s0[L], s1[L], s2[L], s3[L], s4[L];
+    uint32_t t, i, l;
+
+    memcpy(s0, seeds + 0 * L, sizeof(s0));
+    memcpy(s1, seeds + 1 * L, sizeof(s1));
+    memcpy(s2, seeds + 2 * L, sizeof(s2));
+    memcpy(s3, seeds + 3 * L, sizeof(s3));
+    memcpy(s4, seeds + 4 * L, sizeof(s4));
+
+    for(i = 0; i < steps; i++) {
+        for(l = 0; l < L; l++) {
+            t = (s0[l] ^ (s0[l] >> 7));
+            s0[l] = s1[l];
+            s1[l] = s2[l];
+            s2[l] = s3[l];
+            s3[l] = s4[l];
+            s4[l] = (s4[l] ^ (s4[l] << 6)) ^ (t ^ (t << 13));
+            samples[i * L + l] = (s1[l] + s1[l] + 1) * s4[l];
+        }
+    }
+
+    memcpy(seeds + 0 * L, s0, sizeof(s0));
+    memcpy(seeds + 1 * L, s1, sizeof(s1));
+    memcpy(seeds + 2 * L, s2, sizeof(s2));
+    memcpy(seeds + 3 * L, s3, sizeof(s3));
+    memcpy(seeds + 4 * L, s4, sizeof(s4));
+}
+
+
+#ifdef TINYRNG_X86
+
+/*
+ * SSE2 has no 32-bit low multiply (pmulld is SSE4.1), so it is
+ * assembled from two 32 x 32 -> 64 bit multiplies.
+ */
+__attribute__((target("sse2")))
+static inline __m128i mullo32SSE2(__m128i a, __m128i b) {
+    __m128i even = _mm_mul_epu32(a, b);
+    __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+
+    return(_mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                              _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0))));
+}
+
+
+// 4 vectors of 4 lanes
+__attribute__((target("sse2")))
+static void xorshift32vecSSE2(uint32_t *seeds, uint32_t *samples, uint32_t steps) {
+    __m128i s[5][L / 4];
+    __m128i t, one = _mm_set1_epi32(1);
+    uint32_t i, h, w;
+
+    for(w = 0; w < 5; w++)
+        for(h = 0; h < L / 4; h++)
+            s[w][h] = _mm_loadu_si128((const __m128i *)(seeds + w * L + 4 * h));
+
+    for(i = 0; i < steps; i++) {
+        for(h = 0; h < L / 4; h++) {
+            t = _mm_xor_si128(s[0][h], _mm_srli_epi32(s[0][h], 7));
+            s[0][h] = s[1][h];
+            s[1][h] = s[2][h];
+            s[2][h] = s[3][h];
+            s[3][h] = s[4][h];
+            s[4][h] = _mm_xor_si128(_mm_xor_si128(s[4][h], _mm_slli_epi32(s[4][h], 6)),
+                                    _mm_xor_si128(t, _mm_slli_epi32(t, 13)));
+            _mm_storeu_si128((__m128i *)(samples + i * L + 4 * h),
+                             mullo32SSE2(_mm_add_epi32(_mm_add_epi32(s[1][h], s[1][h]), one), s[4][h]));
+        }
+    }
+
+    for(w = 0; w < 5; w++)
+        for(h = 0; h < L / 4; h++)
+            _mm_storeu_si128((__m128i *)(seeds + w * L + 4 * h), s[w][h]);
+}
+
+
+// 2 vectors of 8 lanes
+__attribute__((target("avx2")))
+static void xorshift32vecAVX2(uint32_t *seeds, uint32_t *samples, uint32_t steps) {
+    __m256i s[5][L / 8];
+    __m256i t, one = _mm256_set1_epi32(1);
+    uint32_t i, h, w;
+
+    for(w = 0; w < 5; w++)
+        for(h = 0; h < L / 8; h++)
+            s[w][h] = _mm256_loadu_si256((const __m256i *)(seeds + w * L + 8 * h));
+
+    for(i = 0; i < steps; i++) {
+        for(h = 0; h < L / 8; h++) {
+            t = _mm256_xor_si256(s[0][h], _mm256_srli_epi32(s[0][h], 7));
+            s[0][h] = s[1][h];
+            s[1][h] = s[2][h];
+            s[2][h] = s[3][h];
+            s[3][h] = s[4][h];
+            s[4][h] = _mm256_xor_si256(_mm256_xor_si256(s[4][h], _mm256_slli_epi32(s[4][h], 6)),
+                                       _mm256_xor_si256(t, _mm256_slli_epi32(t, 13)));
+            _mm256_storeu_si256((__m256i *)(samples + i * L + 8 * h),
+                                _mm256_mullo_epi32(_mm256_add_epi32(_mm256_add_epi32(s[1][h], s[1][h]), one), s[4][h]));
+        }
+    }
+
+    for(w = 0; w < 5; w++)
+        for(h = 0; h < L / 8; h++)
+            _mm256_storeu_si256((__m256i *)(seeds + w * L + 8 * h), s[w][h]);
+}
+
+
+// 1 vector of 16 lanes
+__attribute__((target("avx512f")))
+static void xorshift32vecAVX512(uint32_t *seeds, uint32_t *samples, uint32_t steps) {
+    __m512i s0 = _mm512_loadu_si512(seeds + 0 * L);
+    __m512i s1 = _mm512_loadu_si512(seeds + 1 * L);
+    __m512i s2 = _mm512_loadu_si512(seeds + 2 * L);
+    __m512i s3 = _mm512_loadu_si512(seeds + 3 * L);
+    __m512i s4 = _mm512_loadu_si512(seeds + 4 * L);
+    __m512i t, one = _mm512_set1_epi32(1);
+    uint32_t i;
+
+    for(i = 0; i < steps; i++) {
+        t = _mm512_xor_si512(s0, _mm512_srli_epi32(s0, 7));
+        s0 = s1;
+        s1 = s2;
+        s2 = s3;
+        s3 = s4;
+        s4 = _mm512_xor_si512(_mm512_xor_si512(s4, _mm512_slli_epi32(s4, 6)),
+                              _mm512_xor_si512(t, _mm512_slli_epi32(t, 13)));
+        _mm512_storeu_si512(samples + i * L,
+                            _mm512_mullo_epi32(_mm512_add_epi32(_mm512_add_epi32(s1, s1), one), s4));
+    }
+
+    _mm512_storeu_si512(seeds + 0 * L, s0);
+    _mm512_storeu_si512(seeds + 1 * L, s1);
+    _mm512_storeu_si512(seeds + 2 * L, s2);
+    _mm512_storeu_si512(seeds + 3 * L, s3);
+    _mm512_storeu_si512(seeds + 4 * L, s4);
+}
+
+#endif
+
+
+/*
+ * Pick the widest kernel the CPU supports. The choice is made on every
+ * call, __builtin_cpu_supports only reads a cached feature word.
+ */
+static void xorshift32vecKernel(uint32_t *seeds, uint32_t *samples, uint32_t steps) {
+#ifdef TINYRNG_X86
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx512f")) {
+        xorshift32vecAVX512(seeds, samples, steps);
+        return;
+    }
+    if(__builtin_cpu_supports("avx2")) {
+        xorshift32vecAVX2(seeds, samples, steps);
+        return;
+    }
+    if(__builtin_cpu_supports("sse2")) {
+        xorshift32vecSSE2(seeds, samples, steps);
+        return;
+    }
+#endif
+    xorshift32vecScalar(seeds, samples, steps);
+}
+
+
+/*
+ * Fill samples with n words. Full steps of TINYRNG_VEC_LANES words are
+ * written straight to samples. If n is not a multiple of the lane count,
+ * the last step is generated completely and its surplus words are dropped.
+ */
+uint32_t xorshift32vecfill(uint32_t *seeds, uint32_t *samples, uint32_t n) {
+    uint32_t tail[L];
+    uint32_t steps = n / L;
+
+    if(steps > 0) {
+        xorshift32vecKernel(seeds, samples, steps);
+    }
+
+    if(n % L) {
+        xorshift32vecKernel(seeds, tail, 1);
+        memcpy(samples + steps * L, tail, (n % L) * sizeof(uint32_t));
+    }
+
+    return(0);
+}
+
+
+// same stream as xorshift32vecfill, always using the portable kernel
+uint32_t xorshift32vecfillScalar(uint32_t *seeds, uint32_t *samples, uint32_t n) {
+    uint32_t tail[L];
+    uint32_t steps = n / L;
+
+    if(steps > 0) {
+        xorshift32vecScalar(seeds, samples, steps);
+    }
+
+    if(n % L) {
+        xorshift32vecScalar(seeds, tail, 1);
+        memcpy(samples + steps * L, tail, (n % L) * sizeof(uint32_t));
+    }
+
+    return(0);
+}
+
+
+/*
+ * Seed all lanes with one call to the OS, no lane may be all zero.
+ */
+uint32_t seedxorshift32vec(uint32_t *seeds) {
+    uint32_t _err = 0;
+    uint32_t lane[5];
+    uint32_t l;
+
+    _err = seed(seeds, 5 * L);
+    if(_err) return(_err);
+
+    for(l = 0; l < L; l++) {
+        xorshift32vecget(seeds, l, lane);
+        while((lane[0] | lane[1] | lane[2] | lane[3] | lane[4]) == 0) {
+            _err = seed(lane, 5);
+            if(_err) return(_err);
+        }
+        xorshift32vecset(seeds, l, lane);
+    }
+
+    return(_err);
+}
+
+
+/*
+ * Seed all lanes from one 64-bit value. The lanes are the first
+ * streams of the stream manager and therefore do not overlap.
+ */
+uint32_t seedxorshift32vecfrom(uint32_t *seeds, uint64_t s) {
+    uint32_t _err = 0;
+    rngstreams streams;
+    uint32_t lane[5];
+    uint32_t l;
+
+    _err = streaminit(&streams, TINYRNG_XORSHIFT32, s);
+    if(_err) return(_err);
+
+    for(l = 0; l < L; l++) {
+        _err = streamget(&streams, l, lane);
+        if(_err) return(_err);
+        xorshift32vecset(seeds, l, lane);
+    }
+
+    return(_err);
+}
+
+
+// copy a 5-word xorshift32 state into lane l
+uint32_t xorshift32vecset(uint32_t *seeds, uint32_t l, uint32_t *lane) {
+    uint32_t w;
+
+    if(l >= L) return(TINYRNG_INTERVAL_ERROR);
+
+    for(w = 0; w < 5; w++) {
+        seeds[w * L + l] = lane[w];
+    }
+
+    return(0);
+}
+
+
+// copy the state of lane l back into a 5-word xorshift32 state
+uint32_t xorshift32vecget(uint32_t *seeds, uint32_t l, uint32_t *lane) {
+    uint32_t w;
+
+    if(l >= L) return(TINYRNG_INTERVAL_ERROR);
+
+    for(w = 0; w < 5; w++) {
+        lane[w] = seeds[w * L + l];
+    }
+
+    return(0);
+}
+
+
+/*
+ * Batched Box-Muller transform.
+ *
+ * The uniforms are drawn in the order of normstdrnd32 / normstdrnd64,
+ * u1 for the radius and u2 for the angle, and both results of a pair
+ * go straight to the output, r * cos first. The radius is taken from
+ * 1 - u1, which lies in (0, 1] while u1 may be 0. log, sin and cos are
+ * evaluated by polynomial kernels instead of libm:
+ *
+ *   log: fdlibm (double) and Cephes (float) kernels on [sqrt(1/2), sqrt(2)),
+ *   sin, cos: fdlibm (double) and Cephes (float) kernels on [-pi/4, pi/4].
+ *
+ * The angle 2 pi u2 is reduced exactly on u2 itself, u2 - q / 4 with
+ * q = round(4 u2), so the kernels are accurate to about 1 ulp over the
+ * whole circle. The AVX2 kernels perform the same multiplies and adds
+ * in the same order as the portable kernels and therefore produce the
+ * same samples. Compared to the libm path of normstdrnd32 / normstdrnd64
+ * the samples differ by less than 2e-6 absolute for float and 5e-15 for
+ * double, see TinyRNG.h. The float difference comes from rounding the
+ * angle 2 pi u2 to float there and reaches a few percent relative near 0.
+ *
+ * References:
+ * Sun Microsystems, "fdlibm", e_log.c, k_sin.c, k_cos.c, 1993
+ * Moshier, S. L., "Cephes Math Library", logf.c, sinf.c, 1984
+ */
+
+// number of pairs per chunk, the uniforms are buffered on the stack
+#define BM_CHUNK 64
+
+#define SQRT2_64 1.41421356237309504880
+#define SQRT2_32 1.41421356237309504880f
+
+// fdlibm log
+#define LN2_HI 6.93147180369123816490e-01
+#define LN2_LO 1.90821492927058770002e-10
+#define LG1 6.666666666666735130e-01
+#define LG2 3.999999999940941908e-01
+#define LG3 2.857142874366239149e-01
+#define LG4 2.222219843214978396e-01
+#define LG5 1.818357216161805012e-01
+#define LG6 1.531383769920937332e-01
+#define LG7 1.479819860511658591e-01
+
+// fdlibm sin and cos
+#define S1 -1.66666666666666324348e-01
+#define S2 8.33333333332248946124e-03
+#define S3 -1.98412698298579493134e-04
+#define S4 2.75573137070700676789e-06
+#define S5 -2.50507602534068634195e-08
+#define S6 1.58969099521155010221e-10
+#define C1 4.16666666666666019037e-02
+#define C2 -1.38888888888741095749e-03
+#define C3 2.48015872894767294178e-05
+#define C4 -2.75573143513906633035e-07
+#define C5 2.08757232129817482790e-09
+#define C6 -1.13596475577881948265e-11
+
+// Cephes logf
+#define LF_HI 0.693359375f
+#define LF_LO -2.12194440e-4f
+#define LF1 7.0376836292e-2f
+#define LF2 -1.1514610310e-1f
+#define LF3 1.1676998740e-1f
+#define LF4 -1.2420140846e-1f
+#define LF5 1.4249322787e-1f
+#define LF6 -1.6668057665e-1f
+#define LF7 2.0000714765e-1f
+#define LF8 -2.4999993993e-1f
+#define LF9 3.3333331174e-1f
+
+// Cephes sinf and cosf
+#define SF1 -1.9515295891e-4f
+#define SF2 8.3321608736e-3f
+#define SF3 -1.6666654611e-1f
+#define CF1 2.443315711809948e-5f
+#define CF2 -1.388731625493765e-3f
+#define CF3 4.166664568298827e-2f
+
+// fdlibm exp
+#define INVLN2 1.44269504088896338700e+00
+#define EXP_MAX 7.09782712893383973096e+02
+#define P1 1.66666666666666019037e-01
+#define P2 -2.77777777770155933842e-03
+#define P3 6.61375632143793436117e-05
+#define P4 -1.65339022054652515390e-06
+#define P5 4.13813679705723846039e-08
+
+// Cephes expf
+#define INVLN2_32 1.44269504088896341f
+#define EXPF_MAX 88.72283905206835f
+#define PF1 1.9875691500e-4f
+#define PF2 1.3981999507e-3f
+#define PF3 8.3334519073e-3f
+#define PF4 4.1665795894e-2f
+#define PF5 1.6666665459e-1f
+#define PF6 5.0000001201e-1f
+
+
+/*
+ * log and exp kernels shared by the batched transforms. log takes zero
+ * or a positive normal number. exp returns infinity above the overflow
+ * threshold and flushes results below e^-708 (e^-86 for float) to
+ * zero. The AVX2 versions below repeat the operations in order.
+ */
+static inline double log64Kernel(double u) {
+    uint64_t b;
+    double x, k, f, t, z, w, R, hfsq;
+
+    memcpy(&b, &u, sizeof(b));
+    k = (double)(int32_t)(b >> 52) - 1023.0;
+    b = (b & 0x000FFFFFFFFFFFFFULL) | 0x3FF0000000000000ULL;
+    memcpy(&x, &b, sizeof(b));
+    if(x > SQRT2_64) {
+        x = x * 0.5;
+        k = k + 1.0;
+    }
+    f = x - 1.0;
+    t = f / (2.0 + f);
+    z = t * t;
+    w = z * z;
+    R = z * (LG1 + w * (LG3 + w * (LG5 + w * LG7))) + w * (LG2 + w * (LG4 + w * LG6));
+    hfsq = 0.5 * f * f;
+    x = k * LN2_HI - ((hfsq - (t * (hfsq + R) + k * LN2_LO)) - f);
+
+    return(u == 0.0 ? -INFINITY : x);
+}
+
+
+static inline float log32Kernel(float u) {
+    uint32_t b;
+    float x, k, z, y;
+
+    memcpy(&b, &u, sizeof(b));
+    k = (float)(int32_t)(b >> 23) - 127.0f;
+    b = (b & 0x007FFFFF) | 0x3F800000;
+    memcpy(&x, &b, sizeof(b));
+    if(x > SQRT2_32) {
+        x = x * 0.5f;
+        k = k + 1.0f;
+    }
+    x = x - 1.0f;
+    z = x * x;
+    y = ((((((((LF1 * x + LF2) * x + LF3) * x + LF4) * x + LF5) * x + LF6) * x + LF7) * x + LF8) * x + LF9) * x * z;
+    y = y + LF_LO * k;
+    y = y - 0.5f * z;
+    x = x + y;
+    x = x + LF_HI * k;
+
+    return(u == 0.0f ? -INFINITY : x);
+}
+
+
+static inline double exp64Kernel(double u) {
+    uint64_t b;
+    double x, k, hi, lo, r, t, c, y;
+
+    x = u < -708.0 ? -708.0 : (u > EXP_MAX ? EXP_MAX : u);
+    k = nearbyint(x * INVLN2);
+    hi = x - k * LN2_HI;
+    lo = k * LN2_LO;
+    r = hi - lo;
+    t = r * r;
+    c = r - t * (P1 + t * (P2 + t * (P3 + t * (P4 + t * P5))));
+    y = 1.0 - ((lo - (r * c) / (2.0 - c)) - hi);
+
+    // 2^(k - 1) from the low bits of k + 2^52 + 1022
+    t = k + 4503599627371518.0;
+    memcpy(&b, &t, sizeof(b));
+    b = b << 52;
+    memcpy(&t, &b, sizeof(b));
+    y = (y * 2.0) * t;
+
+    if(u < -708.0) y = 0.0;
+    if(u > EXP_MAX) y = INFINITY;
+    return(y);
+}
+
+
+static inline float exp32Kernel(float u) {
+    uint32_t b;
+    float x, k, z, y, t;
+
+    x = u < -86.0f ? -86.0f : (u > EXPF_MAX ? EXPF_MAX : u);
+    k = nearbyintf(x * INVLN2_32);
+    x = x - k * LF_HI;
+    x = x - k * LF_LO;
+    z = x * x;
+    y = (((((PF1 * x + PF2) * x + PF3) * x + PF4) * x + PF5) * x + PF6) * z + x + 1.0f;
+
+    // 2^(k - 1) from the low bits of k + 2^23 + 126
+    t = k + 8388734.0f;
+    memcpy(&b, &t, sizeof(b));
+    b = b << 23;
+    memcpy(&t, &b, sizeof(b));
+    y = (y * 2.0f) * t;
+
+    if(u < -86.0f) y = 0.0f;
+    if(u > EXPF_MAX) y = INFINITY;
+    return(y);
+}
+
+
+#ifdef TINYRNG_X86
+
+__attribute__((target("avx2")))
+static inline __m256d log4AVX2(__m256d u) {
+    const __m256d one = _mm256_set1_pd(1.0), half = _mm256_set1_pd(0.5);
+    const __m256d magic = _mm256_set1_pd(4503599627370496.0);
+    const __m256i mant = _mm256_set1_epi64x(0x000FFFFFFFFFFFFFLL), expo = _mm256_set1_epi64x(0x3FF0000000000000LL);
+    const __m256i magici = _mm256_set1_epi64x(0x4330000000000000LL);
+    __m256d x, k, f, t, z, w, R, hfsq, tmp, mask;
+    __m256i b;
+
+    b = _mm256_castpd_si256(u);
+    k = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(_mm256_srli_epi64(b, 52), magici)), magic);
+    k = _mm256_sub_pd(k, _mm256_set1_pd(1023.0));
+    x = _mm256_castsi256_pd(_mm256_or_si256(_mm256_and_si256(b, mant), expo));
+    mask = _mm256_cmp_pd(x, _mm256_set1_pd(SQRT2_64), _CMP_GT_OQ);
+    x = _mm256_blendv_pd(x, _mm256_mul_pd(x, half), mask);
+    k = _mm256_blendv_pd(k, _mm256_add_pd(k, one), mask);
+    f = _mm256_sub_pd(x, one);
+    t = _mm256_div_pd(f, _mm256_add_pd(_mm256_set1_pd(2.0), f));
+    z = _mm256_mul_pd(t, t);
+    w = _mm256_mul_pd(z, z);
+    R = _mm256_add_pd(_mm256_set1_pd(LG5), _mm256_mul_pd(w, _mm256_set1_pd(LG7)));
+    R = _mm256_add_pd(_mm256_set1_pd(LG3), _mm256_mul_pd(w, R));
+    R = _mm256_add_pd(_mm256_set1_pd(LG1), _mm256_mul_pd(w, R));
+    R = _mm256_mul_pd(z, R);
+    tmp = _mm256_add_pd(_mm256_set1_pd(LG4), _mm256_mul_pd(w, _mm256_set1_pd(LG6)));
+    tmp = _mm256_add_pd(_mm256_set1_pd(LG2), _mm256_mul_pd(w, tmp));
+    R = _mm256_add_pd(R, _mm256_mul_pd(w, tmp));
+    hfsq = _mm256_mul_pd(_mm256_mul_pd(half, f), f);
+    tmp = _mm256_add_pd(_mm256_mul_pd(t, _mm256_add_pd(hfsq, R)), _mm256_mul_pd(k, _mm256_set1_pd(LN2_LO)));
+    x = _mm256_sub_pd(_mm256_mul_pd(k, _mm256_set1_pd(LN2_HI)), _mm256_sub_pd(_mm256_sub_pd(hfsq, tmp), f));
+    mask = _mm256_cmp_pd(u, _mm256_setzero_pd(), _CMP_EQ_OQ);
+
+    return(_mm256_blendv_pd(x, _mm256_set1_pd(-INFINITY), mask));
+}
+
+
+__attribute__((target("avx2")))
+static inline __m256 log8AVX2(__m256 u) {
+    const __m256 one = _mm256_set1_ps(1.0f), half = _mm256_set1_ps(0.5f);
+    const __m256i mant = _mm256_set1_epi32(0x007FFFFF), expo = _mm256_set1_epi32(0x3F800000);
+    __m256 x, k, z, y, mask;
+    __m256i b;
+
+    b = _mm256_castps_si256(u);
+    k = _mm256_sub_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(b, 23)), _mm256_set1_ps(127.0f));
+    x = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(b, mant), expo));
+    mask = _mm256_cmp_ps(x, _mm256_set1_ps(SQRT2_32), _CMP_GT_OQ);
+    x = _mm256_blendv_ps(x, _mm256_mul_ps(x, half), mask);
+    k = _mm256_blendv_ps(k, _mm256_add_ps(k, one), mask);
+    x = _mm256_sub_ps(x, one);
+    z = _mm256_mul_ps(x, x);
+    y = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(LF1), x), _mm256_set1_ps(LF2));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(LF3));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(LF4));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(LF5));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(LF6));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(LF7));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(LF8));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(LF9));
+    y = _mm256_mul_ps(_mm256_mul_ps(y, x), z);
+    y = _mm256_add_ps(y, _mm256_mul_ps(_mm256_set1_ps(LF_LO), k));
+    y = _mm256_sub_ps(y, _mm256_mul_ps(half, z));
+    x = _mm256_add_ps(x, y);
+    x = _mm256_add_ps(x, _mm256_mul_ps(_mm256_set1_ps(LF_HI), k));
+    mask = _mm256_cmp_ps(u, _mm256_setzero_ps(), _CMP_EQ_OQ);
+
+    return(_mm256_blendv_ps(x, _mm256_set1_ps(-INFINITY), mask));
+}
+
+
+__attribute__((target("avx2")))
+static inline __m256d exp4AVX2(__m256d u) {
+    const __m256d lo = _mm256_set1_pd(-708.0), hi = _mm256_set1_pd(EXP_MAX);
+    __m256d x, k, h, l, r, t, c, y;
+
+    x = _mm256_min_pd(_mm256_max_pd(u, lo), hi);
+    k = _mm256_round_pd(_mm256_mul_pd(x, _mm256_set1_pd(INVLN2)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    h = _mm256_sub_pd(x, _mm256_mul_pd(k, _mm256_set1_pd(LN2_HI)));
+    l = _mm256_mul_pd(k, _mm256_set1_pd(LN2_LO));
+    r = _mm256_sub_pd(h, l);
+    t = _mm256_mul_pd(r, r);
+    c = _mm256_add_pd(_mm256_set1_pd(P4), _mm256_mul_pd(t, _mm256_set1_pd(P5)));
+    c = _mm256_add_pd(_mm256_set1_pd(P3), _mm256_mul_pd(t, c));
+    c = _mm256_add_pd(_mm256_set1_pd(P2), _mm256_mul_pd(t, c));
+    c = _mm256_add_pd(_mm256_set1_pd(P1), _mm256_mul_pd(t, c));
+    c = _mm256_sub_pd(r, _mm256_mul_pd(t, c));
+    y = _mm256_div_pd(_mm256_mul_pd(r, c), _mm256_sub_pd(_mm256_set1_pd(2.0), c));
+    y = _mm256_sub_pd(_mm256_set1_pd(1.0), _mm256_sub_pd(_mm256_sub_pd(l, y), h));
+
+    t = _mm256_add_pd(k, _mm256_set1_pd(4503599627371518.0));
+    t = _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_castpd_si256(t), 52));
+    y = _mm256_mul_pd(_mm256_mul_pd(y, _mm256_set1_pd(2.0)), t);
+
+    y = _mm256_andnot_pd(_mm256_cmp_pd(u, lo, _CMP_LT_OQ), y);
+    return(_mm256_blendv_pd(y, _mm256_set1_pd(INFINITY), _mm256_cmp_pd(u, _mm256_set1_pd(EXP_MAX), _CMP_GT_OQ)));
+}
+
+
+__attribute__((target("avx2")))
+static inline __m256 exp8AVX2(__m256 u) {
+    const __m256 lo = _mm256_set1_ps(-86.0f), hi = _mm256_set1_ps(EXPF_MAX);
+    __m256 x, k, z, y, t;
+
+    x = _mm256_min_ps(_mm256_max_ps(u, lo), hi);
+    k = _mm256_round_ps(_mm256_mul_ps(x, _mm256_set1_ps(INVLN2_32)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    x = _mm256_sub_ps(x, _mm256_mul_ps(k, _mm256_set1_ps(LF_HI)));
+    x = _mm256_sub_ps(x, _mm256_mul_ps(k, _mm256_set1_ps(LF_LO)));
+    z = _mm256_mul_ps(x, x);
+    y = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(PF1), x), _mm256_set1_ps(PF2));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(PF3));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(PF4));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(PF5));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(PF6));
+    y = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(y, z), x), _mm256_set1_ps(1.0f));
+
+    t = _mm256_add_ps(k, _mm256_set1_ps(8388734.0f));
+    t = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(t), 23));
+    y = _mm256_mul_ps(_mm256_mul_ps(y, _mm256_set1_ps(2.0f)), t);
+
+    y = _mm256_andnot_ps(_mm256_cmp_ps(u, lo, _CMP_LT_OQ), y);
+    return(_mm256_blendv_ps(y, _mm256_set1_ps(INFINITY), _mm256_cmp_ps(u, _mm256_set1_ps(EXPF_MAX), _CMP_GT_OQ)));
+}
+
+#endif
+
+
+// portable kernels, m pairs (u, v) to (r cos, r sin)
+static void boxmuller64Scalar(const double *u, const double *v, double *c, double *s, uint32_t m) {
+    double z, r, q, a, sn, cs, tmp;
+    uint32_t i, qi;
+
+    for(i = 0; i < m; i++) {
+        // r = sqrt(-2 log(u))
+        r = sqrt(-2.0 * log64Kernel(u[i]));
+
+        // angle 2 pi v, reduced to [-pi/4, pi/4] and quadrant q
+        q = nearbyint(4.0 * v[i]);
+        a = TWOPI64 * (v[i] - 0.25 * q);
+        z = a * a;
+        sn = a + a * z * (S1 + z * (S2 + z * (S3 + z * (S4 + z * (S5 + z * S6)))));
+        cs = (1.0 - 0.5 * z) + z * z * (C1 + z * (C2 + z * (C3 + z * (C4 + z * (C5 + z * C6)))));
+
+        qi = (uint32_t)q & 3;
+        if(qi & 1) {
+            tmp = cs;
+            cs = -sn;
+            sn = tmp;
+        }
+        if(qi & 2) {
+            cs = -cs;
+            sn = -sn;
+        }
+
+        c[i] = r * cs;
+        s[i] = r * sn;
+    }
+}
+
+
+static void boxmuller32Scalar(const float *u, const float *v, float *c, float *s, uint32_t m) {
+    float z, r, q, a, sn, cs, tmp;
+    uint32_t i, qi;
+
+    for(i = 0; i < m; i++) {
+        // r = sqrt(-2 log(u))
+        r = sqrtf(-2.0f * log32Kernel(u[i]));
+
+        // angle 2 pi v, reduced to [-pi/4, pi/4] and quadrant q
+        q = nearbyintf(4.0f * v[i]);
+        a = TWOPI32 * (v[i] - 0.25f * q);
+        z = a * a;
+        sn = ((SF1 * z + SF2) * z + SF3) * z * a + a;
+        cs = ((CF1 * z + CF2) * z + CF3) * z * z - 0.5f * z + 1.0f;
+
+        qi = (uint32_t)q & 3;
+        if(qi & 1) {
+            tmp = cs;
+            cs = -sn;
+            sn = tmp;
+        }
+        if(qi & 2) {
+            cs = -cs;
+            sn = -sn;
+        }
+
+        c[i] = r * cs;
+        s[i] = r * sn;
+    }
+}
+
+
+#ifdef TINYRNG_X86
+
+// 4 pairs per iteration, m must be a multiple of 4
+__attribute__((target("avx2")))
+static void boxmuller64AVX2(const double *u, const double *v, double *c, double *s, uint32_t m) {
+    const __m256d one = _mm256_set1_pd(1.0), half = _mm256_set1_pd(0.5), two = _mm256_set1_pd(2.0);
+    __m256d x, z, r, q, a, sn, cs, tmp, mask;
+    uint32_t i;
+
+    for(i = 0; i < m; i += 4) {
+        // r = sqrt(-2 log(u))
+        r = _mm256_sqrt_pd(_mm256_mul_pd(_mm256_set1_pd(-2.0), log4AVX2(_mm256_loadu_pd(u + i))));
+
+        // angle 2 pi v, reduced to [-pi/4, pi/4] and quadrant q
+        x = _mm256_loadu_pd(v + i);
+        q = _mm256_round_pd(_mm256_mul_pd(_mm256_set1_pd(4.0), x), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        a = _mm256_mul_pd(_mm256_set1_pd(TWOPI64), _mm256_sub_pd(x, _mm256_mul_pd(_mm256_set1_pd(0.25), q)));
+        z = _mm256_mul_pd(a, a);
+        tmp = _mm256_add_pd(_mm256_set1_pd(S5), _mm256_mul_pd(z, _mm256_set1_pd(S6)));
+        tmp = _mm256_add_pd(_mm256_set1_pd(S4), _mm256_mul_pd(z, tmp));
+        tmp = _mm256_add_pd(_mm256_set1_pd(S3), _mm256_mul_pd(z, tmp));
+        tmp = _mm256_add_pd(_mm256_set1_pd(S2), _mm256_mul_pd(z, tmp));
+        tmp = _mm256_add_pd(_mm256_set1_pd(S1), _mm256_mul_pd(z, tmp));
+        sn = _mm256_add_pd(a, _mm256_mul_pd(_mm256_mul_pd(a, z), tmp));
+        tmp = _mm256_add_pd(_mm256_set1_pd(C5), _mm256_mul_pd(z, _mm256_set1_pd(C6)));
+        tmp = _mm256_add_pd(_mm256_set1_pd(C4), _mm256_mul_pd(z, tmp));
+        tmp = _mm256_add_pd(_mm256_set1_pd(C3), _mm256_mul_pd(z, tmp));
+        tmp = _mm256_add_pd(_mm256_set1_pd(C2), _mm256_mul_pd(z, tmp));
+        tmp = _mm256_add_pd(_mm256_set1_pd(C1), _mm256_mul_pd(z, tmp));
+        cs = _mm256_add_pd(_mm256_sub_pd(one, _mm256_mul_pd(half, z)), _mm256_mul_pd(_mm256_mul_pd(z, z), tmp));
+
+        // rotate by the quadrant, q = 4 is the same as q = 0
+        mask = _mm256_or_pd(_mm256_cmp_pd(q, one, _CMP_EQ_OQ), _mm256_cmp_pd(q, _mm256_set1_pd(3.0), _CMP_EQ_OQ));
+        tmp = cs;
+        cs = _mm256_blendv_pd(cs, _mm256_xor_pd(sn, _mm256_set1_pd(-0.0)), mask);
+        sn = _mm256_blendv_pd(sn, tmp, mask);
+        mask = _mm256_and_pd(_mm256_or_pd(_mm256_cmp_pd(q, two, _CMP_EQ_OQ), _mm256_cmp_pd(q, _mm256_set1_pd(3.0), _CMP_EQ_OQ)),
+                             _mm256_set1_pd(-0.0));
+        cs = _mm256_xor_pd(cs, mask);
+        sn = _mm256_xor_pd(sn, mask);
+
+        _mm256_storeu_pd(c + i, _mm256_mul_pd(r, cs));
+        _mm256_storeu_pd(s + i, _mm256_mul_pd(r, sn));
+    }
+}
+
+
+// 8 pairs per iteration, m must be a multiple of 8
+__attribute__((target("avx2")))
+static void boxmuller32AVX2(const float *u, const float *v, float *c, float *s, uint32_t m) {
+    const __m256 one = _mm256_set1_ps(1.0f), half = _mm256_set1_ps(0.5f);
+    __m256 x, z, r, q, a, sn, cs, tmp, mask;
+    uint32_t i;
+
+    for(i = 0; i < m; i += 8) {
+        // r = sqrt(-2 log(u))
+        r = _mm256_sqrt_ps(_mm256_mul_ps(_mm256_set1_ps(-2.0f), log8AVX2(_mm256_loadu_ps(u + i))));
+
+        // angle 2 pi v, reduced to [-pi/4, pi/4] and quadrant q
+        x = _mm256_loadu_ps(v + i);
+        q = _mm256_round_ps(_mm256_mul_ps(_mm256_set1_ps(4.0f), x), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        a = _mm256_mul_ps(_mm256_set1_ps(TWOPI32), _mm256_sub_ps(x, _mm256_mul_ps(_mm256_set1_ps(0.25f), q)));
+        z = _mm256_mul_ps(a, a);
+        tmp = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(SF1), z), _mm256_set1_ps(SF2));
+        tmp = _mm256_add_ps(_mm256_mul_ps(tmp, z), _mm256_set1_ps(SF3));
+        sn = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(tmp, z), a), a);
+        tmp = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(CF1), z), _mm256_set1_ps(CF2));
+        tmp = _mm256_add_ps(_mm256_mul_ps(tmp, z), _mm256_set1_ps(CF3));
+        cs = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(_mm256_mul_ps(tmp, z), z), _mm256_mul_ps(half, z)), one);
+
+        // rotate by the quadrant, q = 4 is the same as q = 0
+        mask = _mm256_or_ps(_mm256_cmp_ps(q, one, _CMP_EQ_OQ), _mm256_cmp_ps(q, _mm256_set1_ps(3.0f), _CMP_EQ_OQ));
+        tmp = cs;
+        cs = _mm256_blendv_ps(cs, _mm256_xor_ps(sn, _mm256_set1_ps(-0.0f)), mask);
+        sn = _mm256_blendv_ps(sn, tmp, mask);
+        mask = _mm256_and_ps(_mm256_or_ps(_mm256_cmp_ps(q, _mm256_set1_ps(2.0f), _CMP_EQ_OQ), _mm256_cmp_ps(q, _mm256_set1_ps(3.0f), _CMP_EQ_OQ)),
+                             _mm256_set1_ps(-0.0f));
+        cs = _mm256_xor_ps(cs, mask);
+        sn = _mm256_xor_ps(sn, mask);
+
+        _mm256_storeu_ps(c + i, _mm256_mul_ps(r, cs));
+        _mm256_storeu_ps(s + i, _mm256_mul_ps(r, sn));
+    }
+}
+
+#endif
+
+
+static void boxmuller64(const double *u, const double *v, double *c, double *s, uint32_t m) {
+    uint32_t done = 0;
+
+#ifdef TINYRNG_X86
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2")) {
+        done = m & ~3U;
+        boxmuller64AVX2(u, v, c, s, done);
+    }
+#endif
+    boxmuller64Scalar(u + done, v + done, c + done, s + done, m - done);
+}
+
+
+static void boxmuller32(const float *u, const float *v, float *c, float *s, uint32_t m) {
+    uint32_t done = 0;
+
+#ifdef TINYRNG_X86
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2")) {
+        done = m & ~7U;
+        boxmuller32AVX2(u, v, c, s, done);
+    }
+#endif
+    boxmuller32Scalar(u + done, v + done, c + done, s + done, m - done);
+}
+
+
+/*
+ * Fill samples with n standard normal samples. If n is odd the second
+ * result of the last pair is dropped.
+ */
+uint32_t normstdrnd64fill(uint32_t (*un)(uint32_t *, uint64_t *, uint32_t), uint32_t *seeds, double *samples, uint32_t n) {
+    uint32_t _err = 0;
+    double uv[2 * BM_CHUNK], u[BM_CHUNK], v[BM_CHUNK], c[BM_CHUNK], s[BM_CHUNK];
+    uint32_t i, m, left;
+
+    while(n > 0) {
+        m = (n + 1) / 2;
+        if(m > BM_CHUNK) m = BM_CHUNK;
+
+        _err |= unifrnd64fill(un, seeds, uv, 2 * m);
+        for(i = 0; i < m; i++) {
+            u[i] = 1.0 - uv[2 * i];
+            v[i] = uv[2 * i + 1];
+        }
+
+        boxmuller64(u, v, c, s, m);
+
+        left = (n < 2 * m) ? n : 2 * m;
+        for(i = 0; i < left; i++) {
+            samples[i] = (i & 1) ? s[i / 2] : c[i / 2];
+        }
+        samples += left;
+        n -= left;
+    }
+
+    return(_err);
+}
+
+
+uint32_t normstdrnd32fill(uint32_t (*un)(uint32_t *, uint32_t *, uint32_t), uint32_t *seeds, float *samples, uint32_t n) {
+    uint32_t _err = 0;
+    float uv[2 * BM_CHUNK], u[BM_CHUNK], v[BM_CHUNK], c[BM_CHUNK], s[BM_CHUNK];
+    uint32_t i, m, left;
+
+    while(n > 0) {
+        m = (n + 1) / 2;
+        if(m > BM_CHUNK) m = BM_CHUNK;
+
+        _err |= unifrnd32fill(un, seeds, uv, 2 * m);
+        for(i = 0; i < m; i++) {
+            u[i] = 1.0f - uv[2 * i];
+            v[i] = uv[2 * i + 1];
+        }
+
+        boxmuller32(u, v, c, s, m);
+
+        left = (n < 2 * m) ? n : 2 * m;
+        for(i = 0; i < left; i++) {
+            samples[i] = (i & 1) ? s[i / 2] : c[i / 2];
+        }
+        samples += left;
+        n -= left;
+    }
+
+    return(_err);
+}
+
+
+/*
+ * Batched rejection sampling.
+ *
+ * A round draws the inputs of m proposals in bulk and evaluates all of
+ * them side by side. The lane kernels write the candidate of every
+ * proposal, or NaN if it is rejected, and the compaction stores each
+ * candidate at the next free output slot but advances the slot only
+ * for accepted ones, so the samples are packed without a branch. The
+ * next round draws proposals for the rejected lanes only. The tests
+ * are those of gammaTrial, betaTrial and ptrsTrial in TinyRNG.c with
+ * log and exp from the kernels above. PTRS decides most proposals by
+ * its squeeze, the few left over are marked as -1 - k and tested with
+ * libm and logFactorial64 one by one.
+ *
+ * References:
+ * Marsaglia, G. and Tsang, W. W., "A simple method for generating gamma
+ * variables", ACM Trans. Math. Softw., 2000, 26, 363-372
+ * Cheng, R. C. H., "Generating beta variates with nonintegral shape
+ * parameters", Commun. ACM, 1978, 21, 317-322
+ * Hoermann, W., "The transformed rejection method for generating Poisson
+ * random variables", Insur. Math. Econ., 1993, 12, 39-45
+ */
+
+// proposals per round, the inputs are buffered on the stack
+#define REJ_CHUNK 256
+
+
+// portable kernels, m proposals to candidates or NaN
+static void gammaLanes64Scalar(const rngdist *d, const double *x, const double *u, double *y, uint32_t m) {
+    const double c = d->par.gamma.c, dd = d->par.gamma.d, scale = d->par.gamma.d * d->par.gamma.beta;
+    double v, lv;
+    uint32_t i;
+
+    for(i = 0; i < m; i++) {
+        v = 1.0 + c * x[i];
+        v = v * v * v;
+        lv = log64Kernel(v > 0.0 ? v : 1.0);
+        y[i] = (v > 0.0 && log64Kernel(u[i]) < 0.5 * x[i] * x[i] + dd * (1.0 - v + lv)) ? scale * v : NAN;
+    }
+}
+
+
+static void gammaLanes32Scalar(const rngdist *d, const float *x, const float *u, float *y, uint32_t m) {
+    const float c = d->par.gamma.c, dd = d->par.gamma.d, scale = d->par.gamma.d * d->par.gamma.beta;
+    float v, lv;
+    uint32_t i;
+
+    for(i = 0; i < m; i++) {
+        v = 1.0f + c * x[i];
+        v = v * v * v;
+        lv = log32Kernel(v > 0.0f ? v : 1.0f);
+        y[i] = (v > 0.0f && log32Kernel(u[i]) < 0.5f * x[i] * x[i] + dd * (1.0f - v + lv)) ? scale * v : NAN;
+    }
+}
+
+
+// u1 = 0 would pass the test with log(0) on both sides
+static void betaLanes64Scalar(const rngdist *d, const double *u1, const double *u2, double *y, uint32_t m) {
+    const double alpha = d->par.beta.alpha, beta = d->par.beta.beta, s = d->par.beta.s;
+    const double lambda = d->par.beta.lambda, uu = d->par.beta.u, ln4 = d->par.beta.ln4;
+    double v, e, lhs;
+    uint32_t i;
+
+    for(i = 0; i < m; i++) {
+        v = log64Kernel(u1[i] / (1.0 - u1[i])) / lambda;
+        e = alpha * exp64Kernel(v);
+        lhs = s * log64Kernel(s / (beta + e)) + uu * v - ln4;
+        y[i] = (u1[i] > 0.0 && lhs >= log64Kernel(u1[i] * u1[i] * u2[i])) ? e / (beta + e) : NAN;
+    }
+}
+
+
+static void betaLanes32Scalar(const rngdist *d, const float *u1, const float *u2, float *y, uint32_t m) {
+    const float alpha = d->par.beta.alpha, beta = d->par.beta.beta, s = d->par.beta.s;
+    const float lambda = d->par.beta.lambda, uu = d->par.beta.u, ln4 = d->par.beta.ln4;
+    float v, e, lhs;
+    uint32_t i;
+
+    for(i = 0; i < m; i++) {
+        v = log32Kernel(u1[i] / (1.0f - u1[i])) / lambda;
+        e = alpha * exp32Kernel(v);
+        lhs = s * log32Kernel(s / (beta + e)) + uu * v - ln4;
+        y[i] = (u1[i] > 0.0f && lhs >= log32Kernel(u1[i] * u1[i] * u2[i])) ? e / (beta + e) : NAN;
+    }
+}
+
+
+// accepted k, rejected NaN, -1 - k if the squeeze cannot decide
+static void ptrsLanes64Scalar(const rngdist *d, const double *u, const double *w, double *y, uint32_t m) {
+    const double a2 = 2.0 * d->par.ptrs.a, b = d->par.ptrs.b, lambda = d->par.ptrs.lambda, vr = d->par.ptrs.vr;
+    double U, us, k;
+    uint32_t i;
+
+    for(i = 0; i < m; i++) {
+        U = u[i] - 0.5;
+        us = 0.5 - fabs(U);
+        k = floor((a2 / us + b) * U + lambda + 0.43);
+        if(us >= 0.07 && w[i] <= vr) {
+            y[i] = k;
+        } else {
+            y[i] = (k < 0.0 || (us < 0.013 && w[i] > us)) ? NAN : -1.0 - k;
+        }
+    }
+}
+
+
+// y times u^invalpha
+static void powLanes64Scalar(const double *u, double invalpha, double *y, uint32_t m) {
+    uint32_t i;
+
+    for(i = 0; i < m; i++) {
+        y[i] = y[i] * exp64Kernel(log64Kernel(u[i]) * invalpha);
+    }
+}
+
+
+static void powLanes32Scalar(const float *u, float invalpha, float *y, uint32_t m) {
+    uint32_t i;
+
+    for(i = 0; i < m; i++) {
+        y[i] = y[i] * exp32Kernel(log32Kernel(u[i]) * invalpha);
+    }
+}
+
+
+#ifdef TINYRNG_X86
+
+// 4 proposals per iteration, m must be a multiple of 4
+__attribute__((target("avx2")))
+static void gammaLanes64AVX2(const rngdist *d, const double *x, const double *u, double *y, uint32_t m) {
+    const __m256d c = _mm256_set1_pd(d->par.gamma.c), dd = _mm256_set1_pd(d->par.gamma.d);
+    const __m256d scale = _mm256_set1_pd(d->par.gamma.d * d->par.gamma.beta), one = _mm256_set1_pd(1.0);
+    __m256d xi, v, lv, rhs, acc;
+    uint32_t i;
+
+    for(i = 0; i < m; i += 4) {
+        xi = _mm256_loadu_pd(x + i);
+        v = _mm256_add_pd(one, _mm256_mul_pd(c, xi));
+        v = _mm256_mul_pd(_mm256_mul_pd(v, v), v);
+        acc = _mm256_cmp_pd(v, _mm256_setzero_pd(), _CMP_GT_OQ);
+        lv = log4AVX2(_mm256_blendv_pd(one, v, acc));
+        rhs = _mm256_add_pd(_mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(0.5), xi), xi),
+                            _mm256_mul_pd(dd, _mm256_add_pd(_mm256_sub_pd(one, v), lv)));
+        acc = _mm256_and_pd(acc, _mm256_cmp_pd(log4AVX2(_mm256_loadu_pd(u + i)), rhs, _CMP_LT_OQ));
+        _mm256_storeu_pd(y + i, _mm256_blendv_pd(_mm256_set1_pd(NAN), _mm256_mul_pd(scale, v), acc));
+    }
+}
+
+
+// 8 proposals per iteration, m must be a multiple of 8
+__attribute__((target("avx2")))
+static void gammaLanes32AVX2(const rngdist *d, const float *x, const float *u, float *y, uint32_t m) {
+    const __m256 c = _mm256_set1_ps((float)d->par.gamma.c), dd = _mm256_set1_ps((float)d->par.gamma.d);
+    const __m256 scale = _mm256_set1_ps((float)(d->par.gamma.d * d->par.gamma.beta)), one = _mm256_set1_ps(1.0f);
+    __m256 xi, v, lv, rhs, acc;
+    uint32_t i;
+
+    for(i = 0; i < m; i += 8) {
+        xi = _mm256_loadu_ps(x + i);
+        v = _mm256_add_ps(one, _mm256_mul_ps(c, xi));
+        v = _mm256_mul_ps(_mm256_mul_ps(v, v), v);
+        acc = _mm256_cmp_ps(v, _mm256_setzero_ps(), _CMP_GT_OQ);
+        lv = log8AVX2(_mm256_blendv_ps(one, v, acc));
+        rhs = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), xi), xi),
+                            _mm256_mul_ps(dd, _mm256_add_ps(_mm256_sub_ps(one, v), lv)));
+        acc = _mm256_and_ps(acc, _mm256_cmp_ps(log8AVX2(_mm256_loadu_ps(u + i)), rhs, _CMP_LT_OQ));
+        _mm256_storeu_ps(y + i, _mm256_blendv_ps(_mm256_set1_ps(NAN), _mm256_mul_ps(scale, v), acc));
+    }
+}
+
+
+__attribute__((target("avx2")))
+static void betaLanes64AVX2(const rngdist *d, const double *u1, const double *u2, double *y, uint32_t m) {
+    const __m256d alpha = _mm256_set1_pd(d->par.beta.alpha), beta = _mm256_set1_pd(d->par.beta.beta);
+    const __m256d s = _mm256_set1_pd(d->par.beta.s), lambda = _mm256_set1_pd(d->par.beta.lambda);
+    const __m256d uu = _mm256_set1_pd(d->par.beta.u), ln4 = _mm256_set1_pd(d->par.beta.ln4);
+    __m256d x, v, e, be, lhs, acc;
+    uint32_t i;
+
+    for(i = 0; i < m; i += 4) {
+        x = _mm256_loadu_pd(u1 + i);
+        v = _mm256_div_pd(log4AVX2(_mm256_div_pd(x, _mm256_sub_pd(_mm256_set1_pd(1.0), x))), lambda);
+        e = _mm256_mul_pd(alpha, exp4AVX2(v));
+        be = _mm256_add_pd(beta, e);
+        lhs = _mm256_sub_pd(_mm256_add_pd(_mm256_mul_pd(s, log4AVX2(_mm256_div_pd(s, be))), _mm256_mul_pd(uu, v)), ln4);
+        acc = _mm256_cmp_pd(lhs, log4AVX2(_mm256_mul_pd(_mm256_mul_pd(x, x), _mm256_loadu_pd(u2 + i))), _CMP_GE_OQ);
+        acc = _mm256_and_pd(acc, _mm256_cmp_pd(x, _mm256_setzero_pd(), _CMP_GT_OQ));
+        _mm256_storeu_pd(y + i, _mm256_blendv_pd(_mm256_set1_pd(NAN), _mm256_div_pd(e, be), acc));
+    }
+}
+
+
+__attribute__((target("avx2")))
+static void betaLanes32AVX2(const rngdist *d, const float *u1, const float *u2, float *y, uint32_t m) {
+    const __m256 alpha = _mm256_set1_ps((float)d->par.beta.alpha), beta = _mm256_set1_ps((float)d->par.beta.beta);
+    const __m256 s = _mm256_set1_ps((float)d->par.beta.s), lambda = _mm256_set1_ps((float)d->par.beta.lambda);
+    const __m256 uu = _mm256_set1_ps((float)d->par.beta.u), ln4 = _mm256_set1_ps((float)d->par.beta.ln4);
+    __m256 x, v, e, be, lhs, acc;
+    uint32_t i;
+
+    for(i = 0; i < m; i += 8) {
+        x = _mm256_loadu_ps(u1 + i);
+        v = _mm256_div_ps(log8AVX2(_mm256_div_ps(x, _mm256_sub_ps(_mm256_set1_ps(1.0f), x))), lambda);
+        e = _mm256_mul_ps(alpha, exp8AVX2(v));
+        be = _mm256_add_ps(beta, e);
+        lhs = _mm256_sub_ps(_mm256_add_ps(_mm256_mul_ps(s, log8AVX2(_mm256_div_ps(s, be))), _mm256_mul_ps(uu, v)), ln4);
+        acc = _mm256_cmp_ps(lhs, log8AVX2(_mm256_mul_ps(_mm256_mul_ps(x, x), _mm256_loadu_ps(u2 + i))), _CMP_GE_OQ);
+        acc = _mm256_and_ps(acc, _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_GT_OQ));
+        _mm256_storeu_ps(y + i, _mm256_blendv_ps(_mm256_set1_ps(NAN), _mm256_div_ps(e, be), acc));
+    }
+}
+
+
+__attribute__((target("avx2")))
+static void ptrsLanes64AVX2(const rngdist *d, const double *u, const double *w, double *y, uint32_t m) {
+    const __m256d a2 = _mm256_set1_pd(2.0 * d->par.ptrs.a), b = _mm256_set1_pd(d->par.ptrs.b);
+    const __m256d lambda = _mm256_set1_pd(d->par.ptrs.lambda), vr = _mm256_set1_pd(d->par.ptrs.vr);
+    const __m256d half = _mm256_set1_pd(0.5);
+    __m256d U, us, k, wi, squeeze, reject;
+    uint32_t i;
+
+    for(i = 0; i < m; i += 4) {
+        U = _mm256_sub_pd(_mm256_loadu_pd(u + i), half);
+        us = _mm256_sub_pd(half, _mm256_andnot_pd(_mm256_set1_pd(-0.0), U));
+        k = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(_mm256_add_pd(_mm256_div_pd(a2, us), b), U), lambda), _mm256_set1_pd(0.43));
+        k = _mm256_floor_pd(k);
+        wi = _mm256_loadu_pd(w + i);
+        squeeze = _mm256_and_pd(_mm256_cmp_pd(us, _mm256_set1_pd(0.07), _CMP_GE_OQ), _mm256_cmp_pd(wi, vr, _CMP_LE_OQ));
+        reject = _mm256_or_pd(_mm256_cmp_pd(k, _mm256_setzero_pd(), _CMP_LT_OQ),
+                              _mm256_and_pd(_mm256_cmp_pd(us, _mm256_set1_pd(0.013), _CMP_LT_OQ), _mm256_cmp_pd(wi, us, _CMP_GT_OQ)));
+        wi = _mm256_blendv_pd(_mm256_sub_pd(_mm256_set1_pd(-1.0), k), _mm256_set1_pd(NAN), reject);
+        _mm256_storeu_pd(y + i, _mm256_blendv_pd(wi, k, squeeze));
+    }
+}
+
+
+__attribute__((target("avx2")))
+static void powLanes64AVX2(const double *u, double invalpha, double *y, uint32_t m) {
+    const __m256d ia = _mm256_set1_pd(invalpha);
+    uint32_t i;
+
+    for(i = 0; i < m; i += 4) {
+        _mm256_storeu_pd(y + i, _mm256_mul_pd(_mm256_loadu_pd(y + i), exp4AVX2(_mm256_mul_pd(log4AVX2(_mm256_loadu_pd(u + i)), ia))));
+    }
+}
+
+
+__attribute__((target("avx2")))
+static void powLanes32AVX2(const float *u, float invalpha, float *y, uint32_t m) {
+    const __m256 ia = _mm256_set1_ps(invalpha);
+    uint32_t i;
+
+    for(i = 0; i < m; i += 8) {
+        _mm256_storeu_ps(y + i, _mm256_mul_ps(_mm256_loadu_ps(y + i), exp8AVX2(_mm256_mul_ps(log8AVX2(_mm256_loadu_ps(u + i)), ia))));
+    }
+}
+
+#endif
+
+
+static void gammaLanes64(const rngdist *d, const double *x, const double *u, double *y, uint32_t m) {
+    uint32_t done = 0;
+
+#ifdef TINYRNG_X86
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2")) {
+        done = m & ~3U;
+        gammaLanes64AVX2(d, x, u, y, done);
+    }
+#endif
+    gammaLanes64Scalar(d, x + done, u + done, y + done, m - done);
+}
+
+
+static void gammaLanes32(const rngdist *d, const float *x, const float *u, float *y, uint32_t m) {
+    uint32_t done = 0;
+
+#ifdef TINYRNG_X86
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2")) {
+        done = m & ~7U;
+        gammaLanes32AVX2(d, x, u, y, done);
+    }
+#endif
+    gammaLanes32Scalar(d, x + done, u + done, y + done, m - done);
+}
+
+
+static void betaLanes64(const rngdist *d, const double *u1, const double *u2, double *y, uint32_t m) {
+    uint32_t done = 0;
+
+#ifdef TINYRNG_X86
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2")) {
+        done = m & ~3U;
+        betaLanes64AVX2(d, u1, u2, y, done);
+    }
+#endif
+    betaLanes64Scalar(d, u1 + done, u2 + done, y + done, m - done);
+}
+
+
+static void betaLanes32(const rngdist *d, const float *u1, const float *u2, float *y, uint32_t m) {
+    uint32_t done = 0;
+
+#ifdef TINYRNG_X86
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2")) {
+        done = m & ~7U;
+        betaLanes32AVX2(d, u1, u2, y, done);
+    }
+#endif
+    betaLanes32Scalar(d, u1 + done, u2 + done, y + done, m - done);
+}
+
+
+static void ptrsLanes64(const rngdist *d, const double *u, const double *w, double *y, uint32_t m) {
+    double k, U, us;
+    uint32_t i, done = 0;
+
+#ifdef TINYRNG_X86
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2")) {
+        done = m & ~3U;
+        ptrsLanes64AVX2(d, u, w, y, done);
+    }
+#endif
+    ptrsLanes64Scalar(d, u + done, w + done, y + done, m - done);
+
+    // the full test of ptrsTrial for the proposals outside the squeeze
+    for(i = 0; i < m; i++) {
+        if(y[i] < 0.0) {
+            k = -1.0 - y[i];
+            U = u[i] - 0.5;
+            us = 0.5 - fabs(U);
+            y[i] = (log(w[i] * d->par.ptrs.invalpha / (d->par.ptrs.a / (us * us) + d->par.ptrs.b))
+                    <= -d->par.ptrs.lambda + k * d->par.ptrs.loglam - logFactorial64(k)) ? k : NAN;
+        }
+    }
+}
+
+
+static void powLanes64(const double *u, double invalpha, double *y, uint32_t m) {
+    uint32_t done = 0;
+
+#ifdef TINYRNG_X86
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2")) {
+        done = m & ~3U;
+        powLanes64AVX2(u, invalpha, y, done);
+    }
+#endif
+    powLanes64Scalar(u + done, invalpha, y + done, m - done);
+}
+
+
+static void powLanes32(const float *u, float invalpha, float *y, uint32_t m) {
+    uint32_t done = 0;
+
+#ifdef TINYRNG_X86
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2")) {
+        done = m & ~7U;
+        powLanes32AVX2(u, invalpha, y, done);
+    }
+#endif
+    powLanes32Scalar(u + done, invalpha, y + done, m - done);
+}
+
+
+uint32_t rejfill64(uint32_t (*un)(uint32_t *, uint64_t *, uint32_t), uint32_t *seeds, const rngdist *d, double *samples, uint32_t n) {
+    uint32_t _err = 0;
+    double a[REJ_CHUNK], b[REJ_CHUNK], y[REJ_CHUNK];
+    uint32_t i, m, k = 0;
+
+    if(d->method != TINYRNG_METHOD_GAMMA && d->method != TINYRNG_METHOD_BETA && d->method != TINYRNG_METHOD_PTRS) {
+        return(TINYRNG_INTERVAL_ERROR);
+    }
+
+    while(k < n && _err == 0) {
+        // one proposal per missing sample
+        m = (n - k < REJ_CHUNK) ? n - k : REJ_CHUNK;
+
+        if(d->method == TINYRNG_METHOD_GAMMA) {
+            _err |= normstdrnd64fill(un, seeds, a, m);
+            _err |= unifrnd64fill(un, seeds, b, m);
+            gammaLanes64(d, a, b, y, m);
+        } else {
+            _err |= unifrnd64fill(un, seeds, a, m);
+            _err |= unifrnd64fill(un, seeds, b, m);
+            if(d->method == TINYRNG_METHOD_BETA) {
+                betaLanes64(d, a, b, y, m);
+            } else {
+                ptrsLanes64(d, a, b, y, m);
+            }
+        }
+
+        // pack the accepted candidates, NaN marks a rejection
+        for(i = 0; i < m; i++) {
+            samples[k] = y[i];
+            k += (y[i] == y[i]);
+        }
+    }
+
+    // alpha <= 1 was boosted to alpha + 1, scale by u^(1 / alpha)
+    if(d->method == TINYRNG_METHOD_GAMMA && d->par.gamma.invalpha > 0.0) {
+        for(k = 0; k < n && _err == 0; k += m) {
+            m = (n - k < REJ_CHUNK) ? n - k : REJ_CHUNK;
+            _err = unifrnd64fill(un, seeds, a, m);
+            powLanes64(a, d->par.gamma.invalpha, samples + k, m);
+        }
+    }
+
+    return(_err);
+}
+
+
+uint32_t rejfill32(uint32_t (*un)(uint32_t *, uint32_t *, uint32_t), uint32_t *seeds, const rngdist *d, float *samples, uint32_t n) {
+    uint32_t _err = 0;
+    float a[REJ_CHUNK], b[REJ_CHUNK], y[REJ_CHUNK];
+    double da[REJ_CHUNK], db[REJ_CHUNK], dy[REJ_CHUNK];
+    uint32_t i, m, k = 0;
+
+    if(d->method != TINYRNG_METHOD_GAMMA && d->method != TINYRNG_METHOD_BETA && d->method != TINYRNG_METHOD_PTRS) {
+        return(TINYRNG_INTERVAL_ERROR);
+    }
+
+    while(k < n && _err == 0) {
+        // one proposal per missing sample
+        m = (n - k < REJ_CHUNK) ? n - k : REJ_CHUNK;
+
+        if(d->method == TINYRNG_METHOD_GAMMA) {
+            _err |= normstdrnd32fill(un, seeds, a, m);
+            _err |= unifrnd32fill(un, seeds, b, m);
+            gammaLanes32(d, a, b, y, m);
+        } else {
+            _err |= unifrnd32fill(un, seeds, a, m);
+            _err |= unifrnd32fill(un, seeds, b, m);
+            if(d->method == TINYRNG_METHOD_BETA) {
+                betaLanes32(d, a, b, y, m);
+            } else {
+                // PTRS stays in double precision as in distrnd32
+                for(i = 0; i < m; i++) {
+                    da[i] = a[i];
+                    db[i] = b[i];
+                }
+                ptrsLanes64(d, da, db, dy, m);
+                for(i = 0; i < m; i++) {
+                    y[i] = dy[i];
+                }
+            }
+        }
+
+        // pack the accepted candidates, NaN marks a rejection
+        for(i = 0; i < m; i++) {
+            samples[k] = y[i];
+            k += (y[i] == y[i]);
+        }
+    }
+
+    // alpha <= 1 was boosted to alpha + 1, scale by u^(1 / alpha)
+    if(d->method == TINYRNG_METHOD_GAMMA && d->par.gamma.invalpha > 0.0) {
+        for(k = 0; k < n && _err == 0; k += m) {
+            m = (n - k < REJ_CHUNK) ? n - k : REJ_CHUNK;
+            _err = unifrnd32fill(un, seeds, a, m);
+            powLanes32(a, (float)d->par.gamma.invalpha, samples + k, m);
+        }
+    }
+
+    return(_err);
+}
@@ -0,0 +1,925 @@
+#include <stdint.h>
+#include <math.h>
+#include <TinyRNG.h>
+
+/**************************************************************************
+ *  This file is part of TinyRNG. Copyright Guido Klingbeil (2013).
+ *
+ *  TinyRNG is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  TinyRNG is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with TinyRNG.  If not, see <http://www.gnu.org/licenses/>.
+ *************************************************************************/
+
+
+/*
+ * Ziggurat method by Marsaglia & Tsang (2000).
+ *
+ * The density is covered by horizontal layers of equal area, 128 for
+ * the normal and 256 for the exponential distribution. One random word
+ * selects a layer (its low 7 or 8 bits) and a position in it (the
+ * remaining bits, signed for the normal), most samples fall into the rectangular
+ * part of their layer and are accepted after a single compare. Only
+ * the wedges and the tail need further uniforms and a call to exp or
+ * log. Unlike the original RNOR the layer index and the position use
+ * disjoint bits of the word.
+ *
+ * For layer i, K is the acceptance threshold x[i-1] / x[i] scaled to
+ * the position range, W = x[i] / scale and F = f(x[i]). The 32-bit
+ * tables are scaled to 2^24, the 64-bit ones to 2^56, i.e. 25 and 57-bit
+ * signed positions for the normal and 24 and 56-bit unsigned positions
+ * for the exponential distribution.
+ */
+
+// right hand end of the base layer
+#define NORM_R32 3.442619855899f
+#define NORM_R64 3.442619855899
+#define EXP_R32 7.697117470131487f
+#define EXP_R64 7.697117470131487
+
+static const uint32_t normK32[128] = {
+    0x00ED5A44U, 0x00000000U, 0x00C01E36U, 0x00D9C88FU, 0x00E4B68DU, 0x00EAC00AU,
+    0x00EE9243U, 0x00F1344BU, 0x00F3208BU, 0x00F4979CU, 0x00F5BEC5U, 0x00F6AD05U,
+    0x00F77151U, 0x00F815CEU, 0x00F8A199U, 0x00F919D8U, 0x00F98259U, 0x00F9DDFDU,
+    0x00FA2EFCU, 0x00FA7711U, 0x00FAB79CU, 0x00FAF1BAU, 0x00FB2651U, 0x00FB561CU,
+    0x00FB81BAU, 0x00FBA9ADU, 0x00FBCE63U, 0x00FBF039U, 0x00FC0F81U, 0x00FC2C7DU,
+    0x00FC476BU, 0x00FC607BU, 0x00FC77DDU, 0x00FC8DB6U, 0x00FCA22AU, 0x00FCB557U,
+    0x00FCC757U, 0x00FCD844U, 0x00FCE832U, 0x00FCF734U, 0x00FD055BU, 0x00FD12B8U,
+    0x00FD1F58U, 0x00FD2B47U, 0x00FD3692U, 0x00FD4141U, 0x00FD4B60U, 0x00FD54F5U,
+    0x00FD5E09U, 0x00FD66A4U, 0x00FD6ECBU, 0x00FD7684U, 0x00FD7DD5U, 0x00FD84C4U,
+    0x00FD8B53U, 0x00FD9188U, 0x00FD9766U, 0x00FD9CF1U, 0x00FDA22CU, 0x00FDA71AU,
+    0x00FDABBEU, 0x00FDB019U, 0x00FDB42EU, 0x00FDB800U, 0x00FDBB8FU, 0x00FDBEDDU,
+    0x00FDC1ECU, 0x00FDC4BDU, 0x00FDC751U, 0x00FDC9A8U, 0x00FDCBC4U, 0x00FDCDA5U,
+    0x00FDCF4CU, 0x00FDD0B8U, 0x00FDD1E9U, 0x00FDD2E0U, 0x00FDD39CU, 0x00FDD41DU,
+    0x00FDD462U, 0x00FDD46AU, 0x00FDD435U, 0x00FDD3C0U, 0x00FDD30CU, 0x00FDD215U,
+    0x00FDD0DAU, 0x00FDCF58U, 0x00FDCD8EU, 0x00FDCB79U, 0x00FDC914U, 0x00FDC65DU,
+    0x00FDC350U, 0x00FDBFE8U, 0x00FDBC1FU, 0x00FDB7F1U, 0x00FDB357U, 0x00FDAE49U,
+    0x00FDA8BFU, 0x00FDA2B0U, 0x00FD9C12U, 0x00FD94D9U, 0x00FD8CF7U, 0x00FD845DU,
+    0x00FD7AFAU, 0x00FD70B8U, 0x00FD6580U, 0x00FD5938U, 0x00FD4BBEU, 0x00FD3CEDU,
+    0x00FD2C98U, 0x00FD1A89U, 0x00FD0680U, 0x00FCF02EU, 0x00FCD732U, 0x00FCBB14U,
+    0x00FC9B3BU, 0x00FC76E6U, 0x00FC4D18U, 0x00FC1C7FU, 0x00FBE354U, 0x00FB9F18U,
+    0x00FB4C34U, 0x00FAE541U, 0x00FA61C1U, 0x00F9B369U, 0x00F8C01EU, 0x00F75217U,
+    0x00F4E442U, 0x00EFACC9U
+};
+
+
+static const float normW32[128] = {
+    2.213171868e-07f, 1.623158841e-08f, 2.162882275e-08f, 2.542424121e-08f,
+    2.845751269e-08f, 3.103351824e-08f, 3.330064883e-08f, 3.534334555e-08f,
+    3.721467241e-08f, 3.895036213e-08f, 4.057573787e-08f, 4.210946627e-08f,
+    4.356574480e-08f, 4.495565083e-08f, 4.628801274e-08f, 4.756999377e-08f,
+    4.880749623e-08f, 5.000544872e-08f, 5.116801519e-08f, 5.229875023e-08f,
+    5.340071634e-08f, 5.447657412e-08f, 5.552865247e-08f, 5.655900392e-08f,
+    5.756944891e-08f, 5.856161139e-08f, 5.953694782e-08f, 6.049677105e-08f,
+    6.144227004e-08f, 6.237452631e-08f, 6.329452775e-08f, 6.420318037e-08f,
+    6.510131818e-08f, 6.598971173e-08f, 6.686907545e-08f, 6.774007392e-08f,
+    6.860332740e-08f, 6.945941664e-08f, 7.030888704e-08f, 7.115225243e-08f,
+    7.198999825e-08f, 7.282258454e-08f, 7.365044852e-08f, 7.447400687e-08f,
+    7.529365787e-08f, 7.610978327e-08f, 7.692274999e-08f, 7.773291171e-08f,
+    7.854061027e-08f, 7.934617696e-08f, 8.014993380e-08f, 8.095219459e-08f,
+    8.175326600e-08f, 8.255344854e-08f, 8.335303748e-08f, 8.415232375e-08f,
+    8.495159474e-08f, 8.575113515e-08f, 8.655122774e-08f, 8.735215410e-08f,
+    8.815419537e-08f, 8.895763301e-08f, 8.976274948e-08f, 9.056982903e-08f,
+    9.137915836e-08f, 9.219102739e-08f, 9.300573005e-08f, 9.382356501e-08f,
+    9.464483648e-08f, 9.546985508e-08f, 9.629893869e-08f, 9.713241336e-08f,
+    9.797061425e-08f, 9.881388670e-08f, 9.966258729e-08f, 1.005170850e-07f,
+    1.013777625e-07f, 1.022450173e-07f, 1.031192637e-07f, 1.040009337e-07f,
+    1.048904791e-07f, 1.057883737e-07f, 1.066951145e-07f, 1.076112249e-07f,
+    1.085372565e-07f, 1.094737923e-07f, 1.104214496e-07f, 1.113808835e-07f,
+    1.123527906e-07f, 1.133379133e-07f, 1.143370450e-07f, 1.153510349e-07f,
+    1.163807946e-07f, 1.174273050e-07f, 1.184916242e-07f, 1.195748967e-07f,
+    1.206783636e-07f, 1.218033753e-07f, 1.229514047e-07f, 1.241240643e-07f,
+    1.253231248e-07f, 1.265505379e-07f, 1.278084625e-07f, 1.290992972e-07f,
+    1.304257174e-07f, 1.317907219e-07f, 1.331976888e-07f, 1.346504434e-07f,
+    1.361533439e-07f, 1.377113869e-07f, 1.393303419e-07f, 1.410169226e-07f,
+    1.427790092e-07f, 1.446259407e-07f, 1.465689050e-07f, 1.486214711e-07f,
+    1.508003278e-07f, 1.531263367e-07f, 1.556260734e-07f, 1.583341605e-07f,
+    1.612969382e-07f, 1.645785196e-07f, 1.682713837e-07f, 1.725163464e-07f,
+    1.775441320e-07f, 1.837747609e-07f, 1.921108356e-07f, 2.051961336e-07f
+};
+
+
+static const float normF32[128] = {
+    1.000000000e+00f, 9.635996931e-01f, 9.362826817e-01f, 9.130436480e-01f,
+    8.922816508e-01f, 8.732430489e-01f, 8.555006079e-01f, 8.387836053e-01f,
+    8.229072114e-01f, 8.077382947e-01f, 7.931770118e-01f, 7.791460859e-01f,
+    7.655841739e-01f, 7.524415592e-01f, 7.396772437e-01f, 7.272569183e-01f,
+    7.151515074e-01f, 7.033360990e-01f, 6.917891434e-01f, 6.804918410e-01f,
+    6.694276673e-01f, 6.585820001e-01f, 6.479418211e-01f, 6.374954773e-01f,
+    6.272324852e-01f, 6.171433708e-01f, 6.072195366e-01f, 5.974531509e-01f,
+    5.878370544e-01f, 5.783646811e-01f, 5.690299911e-01f, 5.598274127e-01f,
+    5.507517931e-01f, 5.417983550e-01f, 5.329626594e-01f, 5.242405727e-01f,
+    5.156282382e-01f, 5.071220511e-01f, 4.987186355e-01f, 4.904148253e-01f,
+    4.822076463e-01f, 4.740943007e-01f, 4.660721527e-01f, 4.581387163e-01f,
+    4.502916437e-01f, 4.425287153e-01f, 4.348478302e-01f, 4.272469983e-01f,
+    4.197243320e-01f, 4.122780401e-01f, 4.049064208e-01f, 3.976078565e-01f,
+    3.903808082e-01f, 3.832238111e-01f, 3.761354695e-01f, 3.691144537e-01f,
+    3.621594954e-01f, 3.552693848e-01f, 3.484429675e-01f, 3.416791412e-01f,
+    3.349768533e-01f, 3.283350984e-01f, 3.217529159e-01f, 3.152293881e-01f,
+    3.087636380e-01f, 3.023548278e-01f, 2.960021568e-01f, 2.897048604e-01f,
+    2.834622082e-01f, 2.772735029e-01f, 2.711380791e-01f, 2.650553023e-01f,
+    2.590245674e-01f, 2.530452985e-01f, 2.471169475e-01f, 2.412389935e-01f,
+    2.354109423e-01f, 2.296323252e-01f, 2.239026994e-01f, 2.182216466e-01f,
+    2.125887731e-01f, 2.070037094e-01f, 2.014661101e-01f, 1.959756531e-01f,
+    1.905320403e-01f, 1.851349970e-01f, 1.797842721e-01f, 1.744796383e-01f,
+    1.692208922e-01f, 1.640078547e-01f, 1.588403711e-01f, 1.537183122e-01f,
+    1.486415742e-01f, 1.436100801e-01f, 1.386237800e-01f, 1.336826526e-01f,
+    1.287867062e-01f, 1.239359802e-01f, 1.191305467e-01f, 1.143705124e-01f,
+    1.096560210e-01f, 1.049872554e-01f, 1.003644410e-01f, 9.578784912e-02f,
+    9.125780083e-02f, 8.677467189e-02f, 8.233889824e-02f, 7.795098251e-02f,
+    7.361150188e-02f, 6.932111739e-02f, 6.508058521e-02f, 6.089077035e-02f,
+    5.675266348e-02f, 5.266740190e-02f, 4.863629586e-02f, 4.466086220e-02f,
+    4.074286807e-02f, 3.688438879e-02f, 3.308788615e-02f, 2.935631744e-02f,
+    2.569329194e-02f, 2.210330462e-02f, 1.859210274e-02f, 1.516729801e-02f,
+    1.183947866e-02f, 8.624484413e-03f, 5.548995221e-03f, 2.669629084e-03f
+};
+
+
+static const uint64_t normK64[128] = {
+    0x00ED5A442469E0B0ULL, 0x0000000000000000ULL, 0x00C01E36A7C9DA48ULL,
+    0x00D9C88F4DC029F0ULL, 0x00E4B68D441E9830ULL, 0x00EAC00A3A172A20ULL,
+    0x00EE9243D6E5A718ULL, 0x00F1344B7AFDFA38ULL, 0x00F3208B87A86578ULL,
+    0x00F4979CBA361140ULL, 0x00F5BEC53E66CF68ULL, 0x00F6AD054C5E3E68ULL,
+    0x00F771518C35A8A8ULL, 0x00F815CE44639A98ULL, 0x00F8A199CEBEBC40ULL,
+    0x00F919D8B6BB26D0ULL, 0x00F98259ADAEAC88ULL, 0x00F9DDFDA5B3EB10ULL,
+    0x00FA2EFC16692DC8ULL, 0x00FA771106182200ULL, 0x00FAB79CD9582838ULL,
+    0x00FAF1BAC8FB6678ULL, 0x00FB26510C6DD910ULL, 0x00FB561CAFBC5EA8ULL,
+    0x00FB81BA60A28D58ULL, 0x00FBA9AD1171E9F8ULL, 0x00FBCE630A835920ULL,
+    0x00FBF039D4A47F18ULL, 0x00FC0F8147E15708ULL, 0x00FC2C7DF4CFC568ULL,
+    0x00FC476B0FC73BC8ULL, 0x00FC607BFB0F1B78ULL, 0x00FC77DD85A809F8ULL,
+    0x00FC8DB6EEFC2138ULL, 0x00FCA22ABBDA4FA0ULL, 0x00FCB557663F2F38ULL,
+    0x00FCC757EF4739D8ULL, 0x00FCD8445907FB38ULL, 0x00FCE8320CD35318ULL,
+    0x00FCF73431770DA8ULL, 0x00FD055BF4514C10ULL, 0x00FD12B8C781D9A0ULL,
+    0x00FD1F58970F8BB8ULL, 0x00FD2B47F67FCDC8ULL, 0x00FD36924817F198ULL,
+    0x00FD4141DEC7A268ULL, 0x00FD4B601B8EC0E0ULL, 0x00FD54F5870C9A88ULL,
+    0x00FD5E09E7C8FC78ULL, 0x00FD66A455AFA708ULL, 0x00FD6ECB4B231170ULL,
+    0x00FD7684B3FB4928ULL, 0x00FD7DD5FAB87220ULL, 0x00FD84C4142561E8ULL,
+    0x00FD8B53899DA7A8ULL, 0x00FD91888222A2A0ULL, 0x00FD9766CA64DD10ULL,
+    0x00FD9CF1DBE172A8ULL, 0x00FDA22CE32EB2A8ULL, 0x00FDA71AC58F4680ULL,
+    0x00FDABBE25DFD1C8ULL, 0x00FDB01968F02180ULL, 0x00FDB42EB9568B18ULL,
+    0x00FDB8000AC9F3C8ULL, 0x00FDBB8F1D0D1B28ULL, 0x00FDBEDD7E7419A8ULL,
+    0x00FDC1EC8E0B8CD0ULL, 0x00FDC4BD7D6794E0ULL, 0x00FDC751521F93D0ULL,
+    0x00FDC9A8E6FA7CC0ULL, 0x00FDCBC4ECCE7648ULL, 0x00FDCDA5EB158CC0ULL,
+    0x00FDCF4C40383558ULL, 0x00FDD0B8218D62C0ULL, 0x00FDD1E99B0EE8D8ULL,
+    0x00FDD2E08EBFDD20ULL, 0x00FDD39CB3C17E40ULL, 0x00FDD41D9511F470ULL,
+    0x00FDD4628FEEDCE8ULL, 0x00FDD46AD1D40E58ULL, 0x00FDD435560D4608ULL,
+    0x00FDD3C0E2CF6E28ULL, 0x00FDD30C05CBDB00ULL, 0x00FDD215102D2460ULL,
+    0x00FDD0DA11EA0838ULL, 0x00FDCF58D456F060ULL, 0x00FDCD8ED3DA1FE0ULL,
+    0x00FDCB7938A10748ULL, 0x00FDC914CE2E8F00ULL, 0x00FDC65DF99201A0ULL,
+    0x00FDC350AE0C4378ULL, 0x00FDBFE85FDCB9A8ULL, 0x00FDBC1FF4E00680ULL,
+    0x00FDB7F1B297C5A0ULL, 0x00FDB357291AA6D8ULL, 0x00FDAE491A4E42C0ULL,
+    0x00FDA8BF5CA5EAC0ULL, 0x00FDA2B0B87100C8ULL, 0x00FD9C12BE84AFF8ULL,
+    0x00FD94D996BB8818ULL, 0x00FD8CF7C45B2048ULL, 0x00FD845DDDE39DE0ULL,
+    0x00FD7AFA35124800ULL, 0x00FD70B86AE56E20ULL, 0x00FD6580EA1B37C0ULL,
+    0x00FD593840D136E0ULL, 0x00FD4BBE4F609EB0ULL, 0x00FD3CED3F002530ULL,
+    0x00FD2C982D9AB910ULL, 0x00FD1A8974E5CA90ULL, 0x00FD068067DDB668ULL,
+    0x00FCF02E5177EE18ULL, 0x00FCD7326658FB20ULL, 0x00FCBB14343E0838ULL,
+    0x00FC9B3BDB13F3B0ULL, 0x00FC76E6F466F098ULL, 0x00FC4D185E553DD8ULL,
+    0x00FC1C7FEA760750ULL, 0x00FBE354BBF182F8ULL, 0x00FB9F18E44C4AE8ULL,
+    0x00FB4C343C9E2980ULL, 0x00FAE541F79370F8ULL, 0x00FA61C12EF4F9C0ULL,
+    0x00F9B36957D77240ULL, 0x00F8C01E3503C0D8ULL, 0x00F75217B8677560ULL,
+    0x00F4E442ECD33358ULL, 0x00EFACC9CB3E9530ULL
+};
+
+
+static const double normW64[128] = {
+    5.15294230444073090e-17, 3.77921117752872778e-18, 5.03585272228257386e-18,
+    5.91954244449110370e-18, 6.62578099742530423e-18, 7.22555402679709537e-18,
+    7.75341150183441174e-18, 8.22901389351605058e-18, 8.66471612981438020e-18,
+    9.06883788537281644e-18, 9.44727516590186150e-18, 9.80437413666041624e-18,
+    1.01434404021007013e-17, 1.04670531194402897e-17, 1.07772677989498287e-17,
+    1.10757522687196090e-17, 1.13638807627874551e-17, 1.16428008109178607e-17,
+    1.19134819120099879e-17, 1.21767516779853115e-17, 1.24333231568815273e-17,
+    1.26838158174135168e-17, 1.29287718949482159e-17, 1.31686692871239358e-17,
+    1.34039318450289421e-17, 1.36349376721943279e-17, 1.38620258812308604e-17,
+    1.40855021431481113e-17, 1.43056432820337028e-17, 1.45227011078558810e-17,
+    1.47369056360094933e-17, 1.49484678093183513e-17, 1.51575818134086128e-17,
+    1.53644270574909151e-17, 1.55691698780844078e-17, 1.57719650119730988e-17,
+    1.59729568758991055e-17, 1.61722806835789052e-17, 1.63700634251416366e-17,
+    1.65664247297071616e-17, 1.67614776283013475e-17, 1.69553292314605417e-17,
+    1.71480813335645279e-17, 1.73398309540477332e-17, 1.75306708240871726e-17,
+    1.77206898260861505e-17, 1.79099733922132916e-17, 1.80986038673755072e-17,
+    1.82866608412687048e-17, 1.84742214535353233e-17, 1.86613606755418461e-17,
+    1.88481515718561467e-17, 1.90346655441395533e-17, 1.92209725598614910e-17,
+    1.94071413679858989e-17, 1.95932397035616614e-17, 1.97793344829674824e-17,
+    1.99654919914105603e-17, 2.01517780641539214e-17, 2.03382582628462823e-17,
+    2.05249980482480911e-17, 2.07120629505862803e-17, 2.08995187387262425e-17,
+    2.10874315893219715e-17, 2.12758682570929795e-17, 2.14648962473794391e-17,
+    2.16545839921446067e-17, 2.18450010306264877e-17, 2.20362181958890806e-17,
+    2.22283078085885618e-17, 2.24213438793524755e-17, 2.26154023212720527e-17,
+    2.28105611741312241e-17, 2.30069008421432983e-17, 2.32045043471407324e-17,
+    2.34034575993686839e-17, 2.36038496882739598e-17, 2.38057731959627149e-17,
+    2.40093245363300139e-17, 2.42146043232499602e-17, 2.44217177716664825e-17,
+    2.46307751359540955e-17, 2.48418921905393749e-17, 2.50551907585054367e-17,
+    2.52707992947649108e-17, 2.54888535314085898e-17, 2.57094971940498450e-17,
+    2.59328827994299662e-17, 2.61591725462772960e-17, 2.63885393134870456e-17,
+    2.66211677821885630e-17, 2.68572557012933650e-17, 2.70970153197985321e-17,
+    2.73406750136196769e-17, 2.75884811402563035e-17, 2.78407001614227058e-17,
+    2.80976210822651219e-17, 2.83595582663979612e-17, 2.86268546993471765e-17,
+    2.88998857899127721e-17, 2.91790638205674315e-17, 2.94648431858054530e-17,
+    2.97577265934211764e-17, 3.00582724509074464e-17, 3.03671037215631653e-17,
+    3.06849186182220820e-17, 3.10125036150213290e-17, 3.13507494113684856e-17,
+    3.17006706950988505e-17, 3.20634308506423797e-17, 3.24403731841065964e-17,
+    3.28330608550758490e-17, 3.32433286178027484e-17, 3.36733508512175568e-17,
+    3.41257324816800279e-17, 3.46036327660749780e-17, 3.51109373851303177e-17,
+    3.56525035317264674e-17, 3.62345188358293905e-17, 3.68650445068030530e-17,
+    3.75548699516312027e-17, 3.83189226514254585e-17, 3.91787345697795837e-17,
+    4.01670919722642148e-17, 4.13377145381779757e-17, 4.27883958572637435e-17,
+    4.47292895025700128e-17, 4.77759478631351072e-17
+};
+
+
+static const double normF64[128] = {
+    1.00000000000000000e+00, 9.63599693127086154e-01, 9.36282681685059570e-01,
+    9.13043647971740202e-01, 8.92281650784026104e-01, 8.73243048910069541e-01,
+    8.55500607869450591e-01, 8.38783605295989609e-01, 8.22907211381408987e-01,
+    8.07738294682960545e-01, 7.93177011771305063e-01, 7.79146085929687704e-01,
+    7.65584173897704501e-01, 7.52441559174611418e-01, 7.39677243672647311e-01,
+    7.27256918344184822e-01, 7.15151507410498599e-01, 7.03336099016158123e-01,
+    6.91789143436675080e-01, 6.80491840997334063e-01, 6.69427667348890365e-01,
+    6.58582000050088046e-01, 6.47941821110222471e-01, 6.37495477335042304e-01,
+    6.27232485249927252e-01, 6.17143370818880932e-01, 6.07219536625120293e-01,
+    5.97453150944516675e-01, 5.87837054434706574e-01, 5.78364681119763135e-01,
+    5.69029991067950935e-01, 5.59827412704086869e-01, 5.50751793114604538e-01,
+    5.41798355025425504e-01, 5.32962659383836135e-01, 5.24240572672984073e-01,
+    5.15628238244001835e-01, 5.07122051075568958e-01, 4.98718635470979499e-01,
+    4.90414825283844114e-01, 4.82207646329485207e-01, 4.74094300693016946e-01,
+    4.66072152689456121e-01, 4.58138716267872059e-01, 4.50291643682039222e-01,
+    4.42528715275468443e-01, 4.34847830249990908e-01, 4.27246998304996073e-01,
+    4.19724332049574378e-01, 4.12278040102661003e-01, 4.04906420807222944e-01,
+    3.97607856493873313e-01, 3.90380808237314580e-01, 3.83223811055901198e-01,
+    3.76135469510562592e-01, 3.69114453664472209e-01, 3.62159495369317574e-01,
+    3.55269384847917091e-01, 3.48442967546326587e-01, 3.41679141231550410e-01,
+    3.34976853313589173e-01, 3.28335098372850298e-01, 3.21752915875984924e-01,
+    3.15229388065010885e-01, 3.08763638006181118e-01, 3.02354827786483538e-01,
+    2.96002156846932984e-01, 2.89704860442959844e-01, 2.83462208223232981e-01,
+    2.77273502919188120e-01, 2.71138079138384613e-01, 2.65055302255589209e-01,
+    2.59024567396204830e-01, 2.53045298507325767e-01, 2.47116947512321411e-01,
+    2.41238993545439817e-01, 2.35410942263479084e-01, 2.29632325232116130e-01,
+    2.23902699385008425e-01, 2.18221646554305398e-01, 2.12588773071730297e-01,
+    2.07003709439926520e-01, 2.01466110074313670e-01, 1.95975653116277737e-01,
+    1.90532040319137147e-01, 1.85134997008992191e-01, 1.79784272123295452e-01,
+    1.74479638330789499e-01, 1.69220892237365000e-01, 1.64007854683420384e-01,
+    1.58840371139479297e-01, 1.53718312208181662e-01, 1.48641574242342256e-01,
+    1.43610080090627756e-01, 1.38623779984594603e-01, 1.33682652583439365e-01,
+    1.28786706195943207e-01, 1.23935980202867821e-01, 1.19130546707650831e-01,
+    1.14370512448866007e-01, 1.09656021014840274e-01, 1.04987255409421318e-01,
+    1.00364441028655868e-01, 9.57878491217314387e-02, 9.12578008268302571e-02,
+    8.67746718947801782e-02, 8.23388982422356558e-02, 7.79509825139733936e-02,
+    7.36115018841134033e-02, 6.93211173935779079e-02, 6.50805852130680734e-02,
+    6.08907703480404058e-02, 5.67526634810498476e-02, 5.26674019030510115e-02,
+    4.86362958598678050e-02, 4.46608622004914246e-02, 4.07428680744441746e-02,
+    3.68843887866562026e-02, 3.30878861462257506e-02, 2.93563174400068502e-02,
+    2.56932919359342711e-02, 2.21033046159270982e-02, 1.85921027370112880e-02,
+    1.51672980105465680e-02, 1.18394786578848617e-02, 8.62448441285988514e-03,
+    5.54899522077134492e-03, 2.66962908388092279e-03
+};
+
+
+
+static const uint32_t expK32[256] = {
+    0x00E290A1U, 0x00000000U, 0x009BEADEU, 0x00C377ACU, 0x00D4DDB9U, 0x00DE893FU,
+    0x00E4A8E8U, 0x00E8DFF1U, 0x00EBF2DEU, 0x00EE49A6U, 0x00F0204EU, 0x00F19BDBU,
+    0x00F2D458U, 0x00F3DA10U, 0x00F4B86DU, 0x00F577ADU, 0x00F61DE8U, 0x00F6AFB7U,
+    0x00F730A5U, 0x00F7A376U, 0x00F80A5BU, 0x00F86718U, 0x00F8BB1BU, 0x00F90790U,
+    0x00F94D70U, 0x00F98D8CU, 0x00F9C892U, 0x00F9FF17U, 0x00FA3199U, 0x00FA6085U,
+    0x00FA8C3AU, 0x00FAB508U, 0x00FADB36U, 0x00FAFF04U, 0x00FB20A6U, 0x00FB404FU,
+    0x00FB5E29U, 0x00FB7A59U, 0x00FB9503U, 0x00FBAE44U, 0x00FBC638U, 0x00FBDCF8U,
+    0x00FBF29AU, 0x00FC0731U, 0x00FC1AD1U, 0x00FC2D8BU, 0x00FC3F6CU, 0x00FC5083U,
+    0x00FC60DDU, 0x00FC7086U, 0x00FC7F88U, 0x00FC8DECU, 0x00FC9BBDU, 0x00FCA902U,
+    0x00FCB5C3U, 0x00FCC208U, 0x00FCCDD7U, 0x00FCD935U, 0x00FCE42AU, 0x00FCEEBAU,
+    0x00FCF8EBU, 0x00FD02C0U, 0x00FD0C3FU, 0x00FD156BU, 0x00FD1E48U, 0x00FD26DAU,
+    0x00FD2F25U, 0x00FD372AU, 0x00FD3EEEU, 0x00FD4673U, 0x00FD4DBCU, 0x00FD54CBU,
+    0x00FD5BA2U, 0x00FD6245U, 0x00FD68B4U, 0x00FD6EF1U, 0x00FD7500U, 0x00FD7AE1U,
+    0x00FD8096U, 0x00FD8620U, 0x00FD8B82U, 0x00FD90BCU, 0x00FD95D1U, 0x00FD9AC1U,
+    0x00FD9F8DU, 0x00FDA437U, 0x00FDA8BFU, 0x00FDAD28U, 0x00FDB171U, 0x00FDB59CU,
+    0x00FDB9A9U, 0x00FDBD9BU, 0x00FDC170U, 0x00FDC52BU, 0x00FDC8CCU, 0x00FDCC54U,
+    0x00FDCFC3U, 0x00FDD319U, 0x00FDD659U, 0x00FDD982U, 0x00FDDC94U, 0x00FDDF91U,
+    0x00FDE279U, 0x00FDE54DU, 0x00FDE80CU, 0x00FDEAB7U, 0x00FDED50U, 0x00FDEFD5U,
+    0x00FDF248U, 0x00FDF4AAU, 0x00FDF6F9U, 0x00FDF937U, 0x00FDFB64U, 0x00FDFD81U,
+    0x00FDFF8DU, 0x00FE018AU, 0x00FE0376U, 0x00FE0553U, 0x00FE0721U, 0x00FE08DFU,
+    0x00FE0A8FU, 0x00FE0C30U, 0x00FE0DC3U, 0x00FE0F48U, 0x00FE10BFU, 0x00FE1228U,
+    0x00FE1383U, 0x00FE14D1U, 0x00FE1611U, 0x00FE1745U, 0x00FE186BU, 0x00FE1984U,
+    0x00FE1A90U, 0x00FE1B8FU, 0x00FE1C82U, 0x00FE1D68U, 0x00FE1E42U, 0x00FE1F0FU,
+    0x00FE1FCFU, 0x00FE2083U, 0x00FE212BU, 0x00FE21C7U, 0x00FE2256U, 0x00FE22D9U,
+    0x00FE234FU, 0x00FE23BAU, 0x00FE2418U, 0x00FE2469U, 0x00FE24AFU, 0x00FE24E8U,
+    0x00FE2514U, 0x00FE2534U, 0x00FE2547U, 0x00FE254EU, 0x00FE2548U, 0x00FE2535U,
+    0x00FE2515U, 0x00FE24E8U, 0x00FE24AEU, 0x00FE2466U, 0x00FE2411U, 0x00FE23AFU,
+    0x00FE233EU, 0x00FE22C0U, 0x00FE2233U, 0x00FE2198U, 0x00FE20EEU, 0x00FE2035U,
+    0x00FE1F6DU, 0x00FE1E96U, 0x00FE1DAEU, 0x00FE1CB7U, 0x00FE1BB0U, 0x00FE1A97U,
+    0x00FE196EU, 0x00FE1832U, 0x00FE16E5U, 0x00FE1586U, 0x00FE1414U, 0x00FE128EU,
+    0x00FE10F5U, 0x00FE0F47U, 0x00FE0D84U, 0x00FE0BACU, 0x00FE09BDU, 0x00FE07B7U,
+    0x00FE059AU, 0x00FE0364U, 0x00FE0115U, 0x00FDFEABU, 0x00FDFC26U, 0x00FDF986U,
+    0x00FDF6C8U, 0x00FDF3ECU, 0x00FDF0F0U, 0x00FDEDD3U, 0x00FDEA95U, 0x00FDE733U,
+    0x00FDE3ABU, 0x00FDDFFDU, 0x00FDDC27U, 0x00FDD826U, 0x00FDD3F9U, 0x00FDCF9DU,
+    0x00FDCB11U, 0x00FDC651U, 0x00FDC15BU, 0x00FDBC2CU, 0x00FDB6C2U, 0x00FDB117U,
+    0x00FDAB2AU, 0x00FDA4F5U, 0x00FD9E76U, 0x00FD97A6U, 0x00FD9081U, 0x00FD8901U,
+    0x00FD8121U, 0x00FD78D9U, 0x00FD7022U, 0x00FD66F4U, 0x00FD5D47U, 0x00FD530FU,
+    0x00FD4843U, 0x00FD3CD5U, 0x00FD30B9U, 0x00FD23DEU, 0x00FD1634U, 0x00FD07A7U,
+    0x00FCF821U, 0x00FCE789U, 0x00FCD5C2U, 0x00FCC2AAU, 0x00FCAE1DU, 0x00FC97EDU,
+    0x00FC7FE6U, 0x00FC65CCU, 0x00FC4957U, 0x00FC2A2FU, 0x00FC07EEU, 0x00FBE213U,
+    0x00FBB805U, 0x00FB8900U, 0x00FB5411U, 0x00FB1800U, 0x00FAD334U, 0x00FA8392U,
+    0x00FA263BU, 0x00F9B72DU, 0x00F930A1U, 0x00F889F0U, 0x00F7B577U, 0x00F69C65U,
+    0x00F51530U, 0x00F2CB0EU, 0x00EEEFB1U, 0x00E6DA6EU
+};
+
+
+static const float expW32[256] = {
+    5.183885974e-07f, 3.805885542e-09f, 6.248862002e-09f, 8.184014615e-09f,
+    9.842373286e-09f, 1.132242022e-08f, 1.267620985e-08f, 1.393499869e-08f,
+    1.511921664e-08f, 1.624305162e-08f, 1.731681558e-08f, 1.834827391e-08f,
+    1.934344274e-08f, 2.030709273e-08f, 2.124308111e-08f, 2.215457829e-08f,
+    2.304422724e-08f, 2.391425841e-08f, 2.476657448e-08f, 2.560281397e-08f,
+    2.642439998e-08f, 2.723257786e-08f, 2.802844495e-08f, 2.881297419e-08f,
+    2.958703312e-08f, 3.035139933e-08f, 3.110677311e-08f, 3.185378797e-08f,
+    3.259301932e-08f, 3.332499179e-08f, 3.405018547e-08f, 3.476904111e-08f,
+    3.548196461e-08f, 3.618933091e-08f, 3.689148732e-08f, 3.758875638e-08f,
+    3.828143838e-08f, 3.896981358e-08f, 3.965414413e-08f, 4.033467579e-08f,
+    4.101163940e-08f, 4.168525226e-08f, 4.235571926e-08f, 4.302323403e-08f,
+    4.368797979e-08f, 4.435013029e-08f, 4.500985051e-08f, 4.566729741e-08f,
+    4.632262050e-08f, 4.697596245e-08f, 4.762745961e-08f, 4.827724243e-08f,
+    4.892543593e-08f, 4.957216011e-08f, 5.021753024e-08f, 5.086165725e-08f,
+    5.150464802e-08f, 5.214660563e-08f, 5.278762965e-08f, 5.342781637e-08f,
+    5.406725900e-08f, 5.470604790e-08f, 5.534427075e-08f, 5.598201275e-08f,
+    5.661935674e-08f, 5.725638340e-08f, 5.789317137e-08f, 5.852979738e-08f,
+    5.916633639e-08f, 5.980286169e-08f, 6.043944502e-08f, 6.107615668e-08f,
+    6.171306561e-08f, 6.235023951e-08f, 6.298774490e-08f, 6.362564722e-08f,
+    6.426401088e-08f, 6.490289938e-08f, 6.554237536e-08f, 6.618250064e-08f,
+    6.682333635e-08f, 6.746494290e-08f, 6.810738013e-08f, 6.875070731e-08f,
+    6.939498321e-08f, 7.004026617e-08f, 7.068661412e-08f, 7.133408464e-08f,
+    7.198273500e-08f, 7.263262225e-08f, 7.328380321e-08f, 7.393633451e-08f,
+    7.459027269e-08f, 7.524567420e-08f, 7.590259542e-08f, 7.656109275e-08f,
+    7.722122262e-08f, 7.788304153e-08f, 7.854660607e-08f, 7.921197302e-08f,
+    7.987919930e-08f, 8.054834206e-08f, 8.121945873e-08f, 8.189260699e-08f,
+    8.256784488e-08f, 8.324523079e-08f, 8.392482350e-08f, 8.460668223e-08f,
+    8.529086667e-08f, 8.597743702e-08f, 8.666645401e-08f, 8.735797895e-08f,
+    8.805207379e-08f, 8.874880108e-08f, 8.944822412e-08f, 9.015040689e-08f,
+    9.085541417e-08f, 9.156331152e-08f, 9.227416537e-08f, 9.298804304e-08f,
+    9.370501276e-08f, 9.442514375e-08f, 9.514850624e-08f, 9.587517153e-08f,
+    9.660521202e-08f, 9.733870128e-08f, 9.807571407e-08f, 9.881632641e-08f,
+    9.956061564e-08f, 1.003086604e-07f, 1.010605409e-07f, 1.018163387e-07f,
+    1.025761367e-07f, 1.033400199e-07f, 1.041080744e-07f, 1.048803884e-07f,
+    1.056570518e-07f, 1.064381561e-07f, 1.072237951e-07f, 1.080140643e-07f,
+    1.088090616e-07f, 1.096088867e-07f, 1.104136417e-07f, 1.112234311e-07f,
+    1.120383617e-07f, 1.128585430e-07f, 1.136840868e-07f, 1.145151079e-07f,
+    1.153517238e-07f, 1.161940550e-07f, 1.170422249e-07f, 1.178963602e-07f,
+    1.187565910e-07f, 1.196230506e-07f, 1.204958760e-07f, 1.213752079e-07f,
+    1.222611910e-07f, 1.231539738e-07f, 1.240537092e-07f, 1.249605543e-07f,
+    1.258746711e-07f, 1.267962260e-07f, 1.277253905e-07f, 1.286623414e-07f,
+    1.296072608e-07f, 1.305603365e-07f, 1.315217622e-07f, 1.324917378e-07f,
+    1.334704696e-07f, 1.344581708e-07f, 1.354550615e-07f, 1.364613694e-07f,
+    1.374773299e-07f, 1.385031864e-07f, 1.395391910e-07f, 1.405856048e-07f,
+    1.416426981e-07f, 1.427107513e-07f, 1.437900551e-07f, 1.448809111e-07f,
+    1.459836324e-07f, 1.470985443e-07f, 1.482259847e-07f, 1.493663051e-07f,
+    1.505198711e-07f, 1.516870634e-07f, 1.528682784e-07f, 1.540639293e-07f,
+    1.552744471e-07f, 1.565002815e-07f, 1.577419021e-07f, 1.589997995e-07f,
+    1.602744871e-07f, 1.615665016e-07f, 1.628764055e-07f, 1.642047880e-07f,
+    1.655522672e-07f, 1.669194919e-07f, 1.683071436e-07f, 1.697159389e-07f,
+    1.711466320e-07f, 1.726000171e-07f, 1.740769319e-07f, 1.755782601e-07f,
+    1.771049356e-07f, 1.786579460e-07f, 1.802383366e-07f, 1.818472157e-07f,
+    1.834857592e-07f, 1.851552166e-07f, 1.868569170e-07f, 1.885922765e-07f,
+    1.903628053e-07f, 1.921701172e-07f, 1.940159386e-07f, 1.959021194e-07f,
+    1.978306455e-07f, 1.998036522e-07f, 2.018234397e-07f, 2.038924907e-07f,
+    2.060134900e-07f, 2.081893477e-07f, 2.104232245e-07f, 2.127185622e-07f,
+    2.150791176e-07f, 2.175090024e-07f, 2.200127298e-07f, 2.225952681e-07f,
+    2.252621050e-07f, 2.280193221e-07f, 2.308736843e-07f, 2.338327468e-07f,
+    2.369049827e-07f, 2.400999394e-07f, 2.434284276e-07f, 2.469027558e-07f,
+    2.505370208e-07f, 2.543474722e-07f, 2.583529759e-07f, 2.625756081e-07f,
+    2.670414297e-07f, 2.717815078e-07f, 2.768332890e-07f, 2.822424767e-07f,
+    2.880656565e-07f, 2.943740538e-07f, 3.012590700e-07f, 3.088407088e-07f,
+    3.172809187e-07f, 3.268057482e-07f, 3.377443652e-07f, 3.506031225e-07f,
+    3.662207523e-07f, 3.861414488e-07f, 4.137178439e-07f, 4.587839526e-07f
+};
+
+
+static const float expF32[256] = {
+    1.000000000e+00f, 9.381436809e-01f, 9.004699299e-01f, 8.717043324e-01f,
+    8.477855006e-01f, 8.269932966e-01f, 8.084216515e-01f, 7.915276370e-01f,
+    7.759568520e-01f, 7.614633888e-01f, 7.478686220e-01f, 7.350380924e-01f,
+    7.228676596e-01f, 7.112747608e-01f, 7.001926551e-01f, 6.895664961e-01f,
+    6.793505723e-01f, 6.695063167e-01f, 6.600008411e-01f, 6.508058334e-01f,
+    6.418967164e-01f, 6.332519942e-01f, 6.248527387e-01f, 6.166821809e-01f,
+    6.087253821e-01f, 6.009689664e-01f, 5.934009017e-01f, 5.860103185e-01f,
+    5.787873586e-01f, 5.717230487e-01f, 5.648091929e-01f, 5.580382823e-01f,
+    5.514034165e-01f, 5.448982377e-01f, 5.385168720e-01f, 5.322538803e-01f,
+    5.261042140e-01f, 5.200631774e-01f, 5.141263938e-01f, 5.082897764e-01f,
+    5.025495018e-01f, 4.969019872e-01f, 4.913438696e-01f, 4.858719873e-01f,
+    4.804833639e-01f, 4.751751930e-01f, 4.699448253e-01f, 4.647897563e-01f,
+    4.597076156e-01f, 4.546961575e-01f, 4.497532512e-01f, 4.448768734e-01f,
+    4.400651008e-01f, 4.353161032e-01f, 4.306281373e-01f, 4.259995411e-01f,
+    4.214287290e-01f, 4.169141864e-01f, 4.124544660e-01f, 4.080481832e-01f,
+    4.036940125e-01f, 3.993906845e-01f, 3.951369818e-01f, 3.909317370e-01f,
+    3.867738291e-01f, 3.826621815e-01f, 3.785957594e-01f, 3.745735676e-01f,
+    3.705946484e-01f, 3.666580798e-01f, 3.627629734e-01f, 3.589084729e-01f,
+    3.550937529e-01f, 3.513180164e-01f, 3.475804946e-01f, 3.438804447e-01f,
+    3.402171491e-01f, 3.365899140e-01f, 3.329980688e-01f, 3.294409643e-01f,
+    3.259179724e-01f, 3.224284850e-01f, 3.189719128e-01f, 3.155476852e-01f,
+    3.121552488e-01f, 3.087940669e-01f, 3.054636192e-01f, 3.021634007e-01f,
+    2.988929210e-01f, 2.956517043e-01f, 2.924392882e-01f, 2.892552235e-01f,
+    2.860990737e-01f, 2.829704145e-01f, 2.798688332e-01f, 2.767939284e-01f,
+    2.737453097e-01f, 2.707225968e-01f, 2.677254199e-01f, 2.647534188e-01f,
+    2.618062427e-01f, 2.588835497e-01f, 2.559850070e-01f, 2.531102900e-01f,
+    2.502590824e-01f, 2.474310757e-01f, 2.446259691e-01f, 2.418434694e-01f,
+    2.390832903e-01f, 2.363451525e-01f, 2.336287834e-01f, 2.309339172e-01f,
+    2.282602939e-01f, 2.256076601e-01f, 2.229757681e-01f, 2.203643758e-01f,
+    2.177732471e-01f, 2.152021511e-01f, 2.126508620e-01f, 2.101191594e-01f,
+    2.076068277e-01f, 2.051136563e-01f, 2.026394391e-01f, 2.001839747e-01f,
+    1.977470661e-01f, 1.953285207e-01f, 1.929281500e-01f, 1.905457697e-01f,
+    1.881811994e-01f, 1.858342628e-01f, 1.835047871e-01f, 1.811926035e-01f,
+    1.788975466e-01f, 1.766194546e-01f, 1.743581692e-01f, 1.721135353e-01f,
+    1.698854013e-01f, 1.676736186e-01f, 1.654780419e-01f, 1.632985288e-01f,
+    1.611349399e-01f, 1.589871390e-01f, 1.568549924e-01f, 1.547383694e-01f,
+    1.526371420e-01f, 1.505511850e-01f, 1.484803756e-01f, 1.464245939e-01f,
+    1.443837222e-01f, 1.423576454e-01f, 1.403462511e-01f, 1.383494289e-01f,
+    1.363670709e-01f, 1.343990717e-01f, 1.324453279e-01f, 1.305057385e-01f,
+    1.285802045e-01f, 1.266686294e-01f, 1.247709186e-01f, 1.228869795e-01f,
+    1.210167218e-01f, 1.191600572e-01f, 1.173168992e-01f, 1.154871636e-01f,
+    1.136707679e-01f, 1.118676317e-01f, 1.100776764e-01f, 1.083008255e-01f,
+    1.065370041e-01f, 1.047861393e-01f, 1.030481602e-01f, 1.013229974e-01f,
+    9.961058367e-02f, 9.791085331e-02f, 9.622374255e-02f, 9.454918938e-02f,
+    9.288713356e-02f, 9.123751663e-02f, 8.960028191e-02f, 8.797537447e-02f,
+    8.636274114e-02f, 8.476233053e-02f, 8.317409301e-02f, 8.159798071e-02f,
+    8.003394754e-02f, 7.848194920e-02f, 7.694194317e-02f, 7.541388873e-02f,
+    7.389774699e-02f, 7.239348088e-02f, 7.090105516e-02f, 6.942043650e-02f,
+    6.795159342e-02f, 6.649449639e-02f, 6.504911779e-02f, 6.361543200e-02f,
+    6.219341541e-02f, 6.078304645e-02f, 5.938430563e-02f, 5.799717563e-02f,
+    5.662164128e-02f, 5.525768968e-02f, 5.390531020e-02f, 5.256449459e-02f,
+    5.123523706e-02f, 4.991753428e-02f, 4.861138557e-02f, 4.731679291e-02f,
+    4.603376108e-02f, 4.476229773e-02f, 4.350241357e-02f, 4.225412241e-02f,
+    4.101744138e-02f, 3.979239102e-02f, 3.857899550e-02f, 3.737728277e-02f,
+    3.618728478e-02f, 3.500903770e-02f, 3.384258215e-02f, 3.268796351e-02f,
+    3.154523217e-02f, 3.041444391e-02f, 2.929566022e-02f, 2.818894876e-02f,
+    2.709438378e-02f, 2.601204665e-02f, 2.494202642e-02f, 2.388442051e-02f,
+    2.283933541e-02f, 2.180688750e-02f, 2.078720407e-02f, 1.978042434e-02f,
+    1.878670074e-02f, 1.780620041e-02f, 1.683910683e-02f, 1.588562184e-02f,
+    1.494596801e-02f, 1.402039140e-02f, 1.310916493e-02f, 1.221259243e-02f,
+    1.133101360e-02f, 1.046481018e-02f, 9.614413643e-03f, 8.780314986e-03f,
+    7.963077438e-03f, 7.163353184e-03f, 6.381905937e-03f, 5.619642207e-03f,
+    4.877655984e-03f, 4.157295121e-03f, 3.460264778e-03f, 2.788798794e-03f,
+    2.145967744e-03f, 1.536299780e-03f, 9.672692823e-04f, 4.541343538e-04f
+};
+
+
+static const uint64_t expK64[256] = {
+    0x00E290A139245E80ULL, 0x0000000000000000ULL, 0x009BEADEBCE169E0ULL,
+    0x00C377AC71F9D390ULL, 0x00D4DDB990757EE0ULL, 0x00DE893FB8CA1FD0ULL,
+    0x00E4A8E87C432628ULL, 0x00E8DFF16AE1C9D0ULL, 0x00EBF2DEAB58C440ULL,
+    0x00EE49A6E8B96280ULL, 0x00F0204EFD64ED80ULL, 0x00F19BDB8EA3C100ULL,
+    0x00F2D458BBE5BC90ULL, 0x00F3DA104B7822D8ULL, 0x00F4B86D78457188ULL,
+    0x00F577AD8A778498ULL, 0x00F61DE83DA32A60ULL, 0x00F6AFB7843CCE20ULL,
+    0x00F730A57372B3F0ULL, 0x00F7A37651B0E650ULL, 0x00F80A5BB6EEA4F0ULL,
+    0x00F867189D3CB588ULL, 0x00F8BB1B4F8FBBA0ULL, 0x00F9079062292B68ULL,
+    0x00F94D70CA8D4388ULL, 0x00F98D8C7DCAA978ULL, 0x00F9C8928ABE0818ULL,
+    0x00F9FF175B734A40ULL, 0x00FA319996BC47B0ULL, 0x00FA6085F8E9D070ULL,
+    0x00FA8C3A62E198F8ULL, 0x00FAB5084E1F65F0ULL, 0x00FADB36C84CCC98ULL,
+    0x00FAFF0410868450ULL, 0x00FB20A6EA22BB88ULL, 0x00FB404FB42CB3B0ULL,
+    0x00FB5E2951581730ULL, 0x00FB7A59E9972790ULL, 0x00FB95038C8789D0ULL,
+    0x00FBAE44BA684EA0ULL, 0x00FBC638D822E600ULL, 0x00FBDCF89209FFA0ULL,
+    0x00FBF29A303CFC40ULL, 0x00FC0731DF1089B8ULL, 0x00FC1AD1ED6C8B08ULL,
+    0x00FC2D8B02B5C898ULL, 0x00FC3F6C4D921308ULL, 0x00FC5083AC9BA7D0ULL,
+    0x00FC60DDD1E9CD68ULL, 0x00FC7086622E8240ULL, 0x00FC7F881009F0B8ULL,
+    0x00FC8DECB41AC708ULL, 0x00FC9BBD623D7EB8ULL, 0x00FCA9027C5B26D0ULL,
+    0x00FCB5C3C319C488ULL, 0x00FCC20864B44490ULL, 0x00FCCDD70A35D408ULL,
+    0x00FCD935E34BF800ULL, 0x00FCE42AB0DB8BD0ULL, 0x00FCEEBACE7EC010ULL,
+    0x00FCF8EB3B0D0E70ULL, 0x00FD02C0A049B608ULL, 0x00FD0C3F59D199C8ULL,
+    0x00FD156B7B5E27E8ULL, 0x00FD1E48D6703418ULL, 0x00FD26DAFF735518ULL,
+    0x00FD2F2552684BE8ULL, 0x00FD372AF7233C18ULL, 0x00FD3EEEE528F628ULL,
+    0x00FD4673E73543A8ULL, 0x00FD4DBC9E72FF78ULL, 0x00FD54CB856DC2B0ULL,
+    0x00FD5BA2F2C41188ULL, 0x00FD62451BA02C28ULL, 0x00FD68B415FCFF50ULL,
+    0x00FD6EF1DABC1600ULL, 0x00FD75004790EB70ULL, 0x00FD7AE120C583F8ULL,
+    0x00FD809612DBD0A8ULL, 0x00FD8620B40EFFA8ULL, 0x00FD8B8285B78FD8ULL,
+    0x00FD90BCF594B1D0ULL, 0x00FD95D15EFD4258ULL, 0x00FD9AC10BFA70C8ULL,
+    0x00FD9F8D364DF058ULL, 0x00FDA437086566B8ULL, 0x00FDA8BF9E3C9FF0ULL,
+    0x00FDAD28062FED50ULL, 0x00FDB17141BFF2C0ULL, 0x00FDB59C46480858ULL,
+    0x00FDB9A9FDA83CC0ULL, 0x00FDBD9B46E3ED48ULL, 0x00FDC170F6B5D040ULL,
+    0x00FDC52BD81A3FB0ULL, 0x00FDC8CCACD07BA0ULL, 0x00FDCC542DD39020ULL,
+    0x00FDCFC30BCB7938ULL, 0x00FDD319EF771438ULL, 0x00FDD6597A0F60B8ULL,
+    0x00FDD98245A48A28ULL, 0x00FDDC94E5752708ULL, 0x00FDDF91E64014F0ULL,
+    0x00FDE279CE914CB0ULL, 0x00FDE54D1F0A06A8ULL, 0x00FDE80C52A47D00ULL,
+    0x00FDEAB7DEF394E0ULL, 0x00FDED50345EB358ULL, 0x00FDEFD5BE59FA10ULL,
+    0x00FDF248E39B26F0ULL, 0x00FDF4AA064B4AF8ULL, 0x00FDF6F984358940ULL,
+    0x00FDF937B6F30BA8ULL, 0x00FDFB64F4145718ULL, 0x00FDFD818D482620ULL,
+    0x00FDFF8DD07FED88ULL, 0x00FE018A08122C48ULL, 0x00FE03767ADAA5A0ULL,
+    0x00FE05536C58A140ULL, 0x00FE07211CCB4C58ULL, 0x00FE08DFC94C5328ULL,
+    0x00FE0A8FABE8CA18ULL, 0x00FE0C30FBB87A58ULL, 0x00FE0DC3ECF3A5A0ULL,
+    0x00FE0F48B1075218ULL, 0x00FE10BF76A82EF0ULL, 0x00FE122869E42000ULL,
+    0x00FE1383B4327E18ULL, 0x00FE14D17C831870ULL, 0x00FE1611E74C0230ULL,
+    0x00FE174516963598ULL, 0x00FE186B2A091760ULL, 0x00FE19843EF4E078ULL,
+    0x00FE1A90705BF640ULL, 0x00FE1B8FD6FB37C0ULL, 0x00FE1C8289514438ULL,
+    0x00FE1D689BA4BFD0ULL, 0x00FE1E4220099A48ULL, 0x00FE1F0F26655A00ULL,
+    0x00FE1FCFBC726D40ULL, 0x00FE2083EDC28308ULL, 0x00FE212BC3BFEB40ULL,
+    0x00FE21C745ADFE38ULL, 0x00FE225678A88950ULL, 0x00FE22D95FA23F48ULL,
+    0x00FE234FFB622820ULL, 0x00FE23BA4A800D98ULL, 0x00FE2418495FDDC8ULL,
+    0x00FE2469F22BFFB0ULL, 0x00FE24AF3CCE90D8ULL, 0x00FE24E81EE98590ULL,
+    0x00FE25148BCDA198ULL, 0x00FE253474703FE0ULL, 0x00FE2547C75FDC60ULL,
+    0x00FE254E70B75500ULL, 0x00FE25485A0FD1B0ULL, 0x00FE25356A714508ULL,
+    0x00FE2515864173B0ULL, 0x00FE24E88F316F18ULL, 0x00FE24AE64296FA0ULL,
+    0x00FE2466E132F608ULL, 0x00FE2411DF611BD0ULL, 0x00FE23AF34B6F738ULL,
+    0x00FE233EB40BF418ULL, 0x00FE22C02CEE01C0ULL, 0x00FE22336B817110ULL,
+    0x00FE2198385E5CD0ULL, 0x00FE20EE586B7070ULL, 0x00FE20358CB5DFB8ULL,
+    0x00FE1F6D92465B10ULL, 0x00FE1E9621F2C9F0ULL, 0x00FE1DAEF02C8DA8ULL,
+    0x00FE1CB7ACCB0A68ULL, 0x00FE1BB002D22CA0ULL, 0x00FE1A9798349B90ULL,
+    0x00FE196E0D9140C8ULL, 0x00FE1832FDEBC440ULL, 0x00FE16E5FE5F9310ULL,
+    0x00FE15869DCCFCF0ULL, 0x00FE1414647FE788ULL, 0x00FE128ED3CF8B20ULL,
+    0x00FE10F565B69CF0ULL, 0x00FE0F478C633AB8ULL, 0x00FE0D84B1BDD9E8ULL,
+    0x00FE0BAC36E66878ULL, 0x00FE09BD73A6B5C0ULL, 0x00FE07B7B5D920A8ULL,
+    0x00FE059A40C26D28ULL, 0x00FE03644C5D7F88ULL, 0x00FE011504979B28ULL,
+    0x00FDFEAB887B95C0ULL, 0x00FDFC26E94A4470ULL, 0x00FDF986297E3058ULL,
+    0x00FDF6C83BB86638ULL, 0x00FDF3EC0193EEE0ULL, 0x00FDF0F04A5D30A8ULL,
+    0x00FDEDD3D1AA2038ULL, 0x00FDEA953DCFC138ULL, 0x00FDE7331E3100D8ULL,
+    0x00FDE3ABE9626F28ULL, 0x00FDDFFDFB1DBD50ULL, 0x00FDDC2791FF3510ULL,
+    0x00FDD826CD068C70ULL, 0x00FDD3F9A8D38560ULL, 0x00FDCF9DFC95B0C8ULL,
+    0x00FDCB1176A55FD8ULL, 0x00FDC65198BA50B8ULL, 0x00FDC15BB3B2DAA0ULL,
+    0x00FDBC2CE2DC4AE0ULL, 0x00FDB6C206AAACA0ULL, 0x00FDB117BECB4A18ULL,
+    0x00FDAB2A6379BF08ULL, 0x00FDA4F5FDFB4E90ULL, 0x00FD9E76401F3A38ULL,
+    0x00FD97A67A9CE1F8ULL, 0x00FD908192214298ULL, 0x00FD8901F2D4B020ULL,
+    0x00FD812182170E10ULL, 0x00FD78D98E23CD30ULL, 0x00FD7022BB3F0828ULL,
+    0x00FD66F4EDF96BA0ULL, 0x00FD5D4732003050ULL, 0x00FD530F9CCFF940ULL,
+    0x00FD48432B7B3510ULL, 0x00FD3CD59A8469E0ULL, 0x00FD30B9368F9098ULL,
+    0x00FD23DEA45F4FF8ULL, 0x00FD16349E2E04A8ULL, 0x00FD07A7A3EF98A8ULL,
+    0x00FCF8219B5DF050ULL, 0x00FCE7895BCFCDE8ULL, 0x00FCD5C220AD5E20ULL,
+    0x00FCC2AADBC17DC0ULL, 0x00FCAE1D5E81FBC0ULL, 0x00FC97ED4E778F90ULL,
+    0x00FC7FE6D4D720E0ULL, 0x00FC65CCF39C2FB8ULL, 0x00FC4957623CB028ULL,
+    0x00FC2A2FC826DC68ULL, 0x00FC07EE19B01CD0ULL, 0x00FBE213C1CF4918ULL,
+    0x00FBB8051AC15658ULL, 0x00FB890078D120D0ULL, 0x00FB5411A5B9A940ULL,
+    0x00FB180005471318ULL, 0x00FAD334827F1E00ULL, 0x00FA839276708B68ULL,
+    0x00FA263B32E37EA8ULL, 0x00F9B72D1C52CCD8ULL, 0x00F930A1A281A010ULL,
+    0x00F889F023D82048ULL, 0x00F7B577D2BE5ED0ULL, 0x00F69C650C40A858ULL,
+    0x00F51530F0916CB8ULL, 0x00F2CB0E3C593290ULL, 0x00EEEFB15D605B20ULL,
+    0x00E6DA6ECF274028ULL
+};
+
+
+static const double expW64[256] = {
+    1.20696750790168035e-16, 8.86126780494106124e-19, 1.45492656208616608e-18,
+    1.90548939044132434e-18, 2.29160610715450926e-18, 2.63620638683045575e-18,
+    2.95141009730378369e-18, 3.24449471538848763e-18, 3.52021694274706793e-18,
+    3.78188016290161159e-18, 4.03188531854535740e-18, 4.27204042523117748e-18,
+    4.50374622341796315e-18, 4.72811347108696347e-18, 4.94604024762184678e-18,
+    5.15826472271984136e-18, 5.36540226055306845e-18, 5.56797217910287953e-18,
+    5.76641747685390230e-18, 5.96111965658071558e-18, 6.15241005465987652e-18,
+    6.34057863062885827e-18, 6.52588087849076726e-18, 6.70854332714766935e-18,
+    6.88876796604379829e-18, 7.06673584154951458e-18, 7.24261000606589048e-18,
+    7.41653795651111260e-18, 7.58865366605891129e-18, 7.75907928895392869e-18,
+    7.92792660037878555e-18, 8.09529821994511756e-18, 8.26128865721169954e-18,
+    8.42598520984084734e-18, 8.58946873897971009e-18, 8.75181434175485964e-18,
+    8.91309193707575188e-18, 9.07336677801825960e-18, 9.23269990172718761e-18,
+    9.39114852590461081e-18, 9.54876639943848294e-18, 9.70560411349726236e-18,
+    9.86170937841219196e-18, 1.00171272708442734e-17, 1.01719004550521581e-17,
+    1.03260693815125030e-17, 1.04796724656738811e-17, 1.06327462492316108e-17,
+    1.07853255459800981e-17, 1.09374435740201881e-17, 1.10891320758627753e-17,
+    1.12404214277691547e-17, 1.13913407394973464e-17, 1.15419179454771951e-17,
+    1.16921798883113727e-17, 1.18421523953911484e-17, 1.19918603493224581e-17,
+    1.21413277527768630e-17, 1.22905777883118507e-17, 1.24396328736438029e-17,
+    1.25885147128036497e-17, 1.27372443435586390e-17, 1.28858421814427390e-17,
+    1.30343280607023215e-17, 1.31827212724321696e-17, 1.33310406001488999e-17,
+    1.34793043530243239e-17, 1.36275303969793486e-17, 1.37757361838196925e-17,
+    1.39239387785774349e-17, 1.40721548852070597e-17, 1.42204008707710280e-17,
+    1.43686927882375885e-17, 1.45170463980027011e-17, 1.46654771882380446e-17,
+    1.48140003941583433e-17, 1.49626310162932867e-17, 1.51113838378422913e-17,
+    1.52602734411837961e-17, 1.54093142236051591e-17, 1.55585204123138757e-17,
+    1.57079060787862006e-17, 1.58574851525049415e-17, 1.60072714341343395e-17,
+    1.61572786081764667e-17, 1.63075202551503359e-17, 1.64580098633321295e-17,
+    1.66087608400922365e-17, 1.67597865228624683e-17, 1.69111001897646686e-17,
+    1.70627150699299506e-17, 1.72146443535359905e-17, 1.73669012015882774e-17,
+    1.75194987554696227e-17, 1.76724501462810433e-17, 1.78257685039957965e-17,
+    1.79794669664473557e-17, 1.81335586881710745e-17, 1.82880568491184249e-17,
+    1.84429746632618738e-17, 1.85983253871078073e-17, 1.87541223281341934e-17,
+    1.89103788531692243e-17, 1.90671083967265540e-17, 1.92243244693124432e-17,
+    1.93820406657196989e-17, 1.95402706733229565e-17, 1.96990282803896894e-17,
+    1.98583273844210396e-17, 2.00181820005364468e-17, 2.01786062699159740e-17,
+    2.03396144683141220e-17, 2.05012210146589682e-17, 2.06634404797504552e-17,
+    2.08262875950717697e-17, 2.09897772617278546e-17, 2.11539245595252722e-17,
+    2.13187447562078667e-17, 2.14842533168628895e-17, 2.16504659135125984e-17,
+    2.18173984349066685e-17, 2.19850669965311361e-17, 2.21534879508500749e-17,
+    2.23226778977966516e-17, 2.24926536955307934e-17, 2.26634324714812664e-17,
+    2.28350316336906472e-17, 2.30074688824823448e-17, 2.31807622224696152e-17,
+    2.33549299749274085e-17, 2.35299907905486537e-17, 2.37059636626077121e-17,
+    2.38828679405547098e-17, 2.40607233440655539e-17, 2.42395499775737489e-17,
+    2.44193683453113703e-17, 2.46001993668879765e-17, 2.47820643934377473e-17,
+    2.49649852243667853e-17, 2.51489841247341926e-17, 2.53340838433024909e-17,
+    2.55203076312948720e-17, 2.57076792618989858e-17, 2.58962230505592253e-17,
+    2.60859638761020119e-17, 2.62769272027411722e-17, 2.64691391030134643e-17,
+    2.66626262816972571e-17, 2.68574161007708099e-17, 2.70535366054700775e-17,
+    2.72510165515098188e-17, 2.74498854335359057e-17, 2.76501735148812239e-17,
+    2.78519118587022815e-17, 2.80551323605788758e-17, 2.82598677826646902e-17,
+    2.84661517894827814e-17, 2.86740189854664104e-17, 2.88835049543526911e-17,
+    2.90946463005442073e-17, 2.93074806925619979e-17, 2.95220469087221996e-17,
+    2.97383848851784834e-17, 2.99565357664828187e-17, 3.01765419588286844e-17,
+    3.03984471861532179e-17, 3.06222965492884024e-17, 3.08481365883661339e-17,
+    3.10760153486981711e-17, 3.13059824503694815e-17, 3.15380891618027311e-17,
+    3.17723884775726713e-17, 3.20089352007721530e-17, 3.22477860302566547e-17,
+    3.24889996531218550e-17, 3.27326368427990774e-17, 3.29787605631868099e-17,
+    3.32274360792730948e-17, 3.34787310747440954e-17, 3.37327157771186425e-17,
+    3.39894630909977621e-17, 3.42490487400727161e-17, 3.45115514185952387e-17,
+    3.47770529530804818e-17, 3.50456384750873241e-17, 3.53173966060032018e-17,
+    3.55924196548522131e-17, 3.58708038302477580e-17, 3.61526494677249820e-17,
+    3.64380612738162079e-17, 3.67271485883754011e-17, 3.70200256668183704e-17,
+    3.73168119841256153e-17, 3.76176325626577761e-17, 3.79226183260625858e-17,
+    3.82319064818108102e-17, 3.85456409351914305e-17, 3.88639727379283848e-17,
+    3.91870605749583506e-17, 3.95150712933388833e-17, 3.98481804777464756e-17,
+    4.01865730775850286e-17, 4.05304440913682133e-17, 4.08799993147780795e-17,
+    4.12354561596536195e-17, 4.15970445521459789e-17, 4.19650079194156372e-17,
+    4.23396042755689008e-17, 4.27211074190705487e-17, 4.31098082556678911e-17,
+    4.35060162629681210e-17, 4.39100611152873413e-17, 4.43222944903099969e-17,
+    4.47430920825535615e-17, 4.51728558527383683e-17, 4.56120165470568989e-17,
+    4.60610365261953836e-17, 4.65204129510027206e-17, 4.69906813802033361e-17,
+    4.74724198458610654e-17, 4.79662534848653128e-17, 4.84728598200988391e-17,
+    4.89929748038930149e-17, 4.95273997598348477e-17, 5.00770093882069437e-17,
+    5.06427610369573434e-17, 5.12257054862884663e-17, 5.18269995536364983e-17,
+    5.24479209009176838e-17, 5.30898855228050165e-17, 5.37544685208435933e-17,
+    5.44434289336746220e-17, 5.51587396129511141e-17, 5.59026234282494001e-17,
+    5.66775974820731898e-17, 5.74865275613244270e-17, 5.83326958088937431e-17,
+    5.92198856657814708e-17, 6.01524896603658070e-17, 6.11356478424029812e-17,
+    6.21754279523996290e-17, 6.32790634018024030e-17, 6.44552728609764806e-17,
+    6.57146975252789162e-17, 6.70705122139007879e-17, 6.85393004282343782e-17,
+    7.01423431834401362e-17, 7.19075810187923733e-17, 7.38727205206521010e-17,
+    7.60903927022622950e-17, 7.86372379359705601e-17, 8.16311506695518289e-17,
+    8.52674134878632595e-17, 8.99055620761192136e-17, 9.63261918754044512e-17,
+    1.06818962982306407e-16
+};
+
+
+static const double expF64[256] = {
+    1.00000000000000000e+00, 9.38143680862196350e-01, 9.00469929925761803e-01,
+    8.71704332381215918e-01, 8.47785500624000044e-01, 8.26993296643059428e-01,
+    8.08421651523016482e-01, 7.91527636972503057e-01, 7.75956852040122436e-01,
+    7.61463388849902612e-01, 7.47868621985201099e-01, 7.35038092431429146e-01,
+    7.22867659593577350e-01, 7.11274760805081008e-01, 7.00192655082792936e-01,
+    6.89566496117082539e-01, 6.79350572264769692e-01, 6.69506316731928841e-01,
+    6.60000841079003586e-01, 6.50805833414574764e-01, 6.41896716427269642e-01,
+    6.33251994214369507e-01, 6.24852738703669197e-01, 6.16682180915210765e-01,
+    6.08725382079625121e-01, 6.00968966365235224e-01, 5.93400901691736316e-01,
+    5.86010318477270808e-01, 5.78787358602847690e-01, 5.71723048664828370e-01,
+    5.64809192912402724e-01, 5.58038282262589891e-01, 5.51403416540643621e-01,
+    5.44898237672441832e-01, 5.38516872002864022e-01, 5.32253880263045320e-01,
+    5.26104213983621727e-01, 5.20063177368235485e-01, 5.14126393814750449e-01,
+    5.08289776410644656e-01, 5.02549501841349500e-01, 4.96901987241551268e-01,
+    4.91343869594034199e-01, 4.85871987341886524e-01, 4.80483363930455765e-01,
+    4.75175193037378873e-01, 4.69944825283961476e-01, 4.64789756250427621e-01,
+    4.59707615642139078e-01, 4.54696157474616836e-01, 4.49753251162756329e-01,
+    4.44876873414549845e-01, 4.40065100842355172e-01, 4.35316103215637851e-01,
+    4.30628137288460056e-01, 4.25999541143035565e-01, 4.21428728997617796e-01,
+    4.16914186433004041e-01, 4.12454465997162290e-01, 4.08048183152033450e-01,
+    4.03694012530531332e-01, 3.99390684475232127e-01, 3.95136981833291157e-01,
+    3.90931736984798106e-01, 3.86773829084138654e-01, 3.82662181496010778e-01,
+    3.78595759409581734e-01, 3.74573567615903047e-01, 3.70594648435146889e-01,
+    3.66658079781515045e-01, 3.62762973354818663e-01, 3.58908472948750557e-01,
+    3.55093752866788182e-01, 3.51318016437484004e-01, 3.47580494621637648e-01,
+    3.43880444704503074e-01, 3.40217149066780689e-01, 3.36589914028678272e-01,
+    3.32998068761809651e-01, 3.29440964264137048e-01, 3.25917972393556910e-01,
+    3.22428484956089834e-01, 3.18971912844957906e-01, 3.15547685227129560e-01,
+    3.12155248774180161e-01, 3.08794066934560740e-01, 3.05463619244590812e-01,
+    3.02163400675694083e-01, 2.98892921015582291e-01, 2.95651704281261696e-01,
+    2.92439288161893074e-01, 2.89255223489678193e-01, 2.86099073737077270e-01,
+    2.82970414538781190e-01, 2.79868833236973313e-01, 2.76793928448517745e-01,
+    2.73745309652803359e-01, 2.70722596799060466e-01, 2.67725419932045239e-01,
+    2.64753418835062593e-01, 2.61806242689363311e-01, 2.58883549749016562e-01,
+    2.55985007030415712e-01, 2.53110290015629791e-01, 2.50259082368862629e-01,
+    2.47431075665327932e-01, 2.44625969131892357e-01, 2.41843469398877464e-01,
+    2.39083290262449372e-01, 2.36345152457059837e-01, 2.33628783437433485e-01,
+    2.30933917169627551e-01, 2.28260293930716812e-01, 2.25607660116684150e-01,
+    2.22975768058120277e-01, 2.20364375843359578e-01, 2.17773247148700611e-01,
+    2.15202151075378767e-01, 2.12650861992978363e-01, 2.10119159388988369e-01,
+    2.07606827724222121e-01, 2.05113656293837793e-01, 2.02639439093709101e-01,
+    2.00183974691911348e-01, 1.97747066105098929e-01, 1.95328520679563272e-01,
+    1.92928149976771407e-01, 1.90545769663195447e-01, 1.88181199404254346e-01,
+    1.85834262762197139e-01, 1.83504787097767436e-01, 1.81192603475496261e-01,
+    1.78897546572478278e-01, 1.76619454590494829e-01, 1.74358169171353411e-01,
+    1.72113535315319977e-01, 1.69885401302527550e-01, 1.67673618617250081e-01,
+    1.65478041874935894e-01, 1.63298528751901678e-01, 1.61134939917591896e-01,
+    1.58987138969314074e-01, 1.56854992369365093e-01, 1.54738369384467944e-01,
+    1.52637142027442718e-01, 1.50551185001039756e-01, 1.48480375643866624e-01,
+    1.46424593878344750e-01, 1.44383722160634581e-01, 1.42357645432472008e-01,
+    1.40346251074862260e-01, 1.38349428863580010e-01, 1.36367070926428635e-01,
+    1.34399071702213407e-01, 1.32445327901387327e-01, 1.30505738468330607e-01,
+    1.28580204545228005e-01, 1.26668629437510505e-01, 1.24770918580830767e-01,
+    1.22886979509544941e-01, 1.21016721826674625e-01, 1.19160057175327488e-01,
+    1.17316899211555373e-01, 1.15487163578633339e-01, 1.13670767882744134e-01,
+    1.11867631670056131e-01, 1.10077676405185218e-01, 1.08300825451033603e-01,
+    1.06537004050001480e-01, 1.04786139306570006e-01, 1.03048160171257563e-01,
+    1.01322997425953493e-01, 9.96105836706370068e-02, 9.79108533114920743e-02,
+    9.62237425504326588e-02, 9.45491893760556923e-02, 9.28871335560433609e-02,
+    9.12375166310399610e-02, 8.96002819100326781e-02, 8.79753744672700372e-02,
+    8.63627411407567325e-02, 8.47623305323679521e-02, 8.31740930096322162e-02,
+    8.15979807092372389e-02, 8.00339475423197250e-02, 7.84819492016062270e-02,
+    7.69419431704803092e-02, 7.54138887340582015e-02, 7.38977469923645519e-02,
+    7.23934808757085296e-02, 7.09010551623715929e-02, 6.94204364987285050e-02,
+    6.79515934219363654e-02, 6.64944963853395521e-02, 6.50491177867535408e-02,
+    6.36154319998070983e-02, 6.21934154085407587e-02, 6.07830464454793898e-02,
+    5.93843056334200162e-02, 5.79971756312004025e-02, 5.66216412837426200e-02,
+    5.52576896766967876e-02, 5.39053101960458164e-02, 5.25644945930714078e-02,
+    5.12352370551259831e-02, 4.99175342827060664e-02, 4.86113855733791983e-02,
+    4.73167929131812492e-02, 4.60337610761748714e-02, 4.47622977329429905e-02,
+    4.35024135688878918e-02, 4.22541224133159352e-02, 4.10174413804145280e-02,
+    3.97923910233738201e-02, 3.85789955030745452e-02, 3.73772827729590487e-02,
+    3.61872847819311103e-02, 3.50090376973970913e-02, 3.38425821508740107e-02,
+    3.26879635089592224e-02, 3.15452321728932894e-02, 3.04144439104662850e-02,
+    2.92956602246370705e-02, 2.81889487639783061e-02, 2.70943837809554666e-02,
+    2.60120466451338843e-02, 2.49420264197314535e-02, 2.38844205115578447e-02,
+    2.28393354063849141e-02, 2.18068875042832615e-02, 2.07872040725778015e-02,
+    1.97804243380094238e-02, 1.87867007446957078e-02, 1.78062004109110390e-02,
+    1.68391068260396251e-02, 1.58856218399728473e-02, 1.49459680116908293e-02,
+    1.40203914031816184e-02, 1.31091649312546771e-02, 1.22125924262550638e-02,
+    1.13310135978342882e-02, 1.04648101810296754e-02, 9.61441364250190458e-03,
+    8.78031498580867341e-03, 7.96307743801673990e-03, 7.16335318363468549e-03,
+    6.38190593731888332e-03, 5.61964220720518898e-03, 4.87765598354210524e-03,
+    4.15729512083351255e-03, 3.46026477783663040e-03, 2.78879879357381072e-03,
+    2.14596774371865169e-03, 1.53629978030132971e-03, 9.67269282326948371e-04,
+    4.54134353841298139e-04
+};
+
+
+/*
+ * Standard normal random sample
+ */
+uint32_t normstdzig32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, float *sample) {
+    uint32_t _err = 0;
+    uint32_t w = 0, iz, a;
+    int32_t hz;
+    float x, y, f = 0.0f;
+
+    for(;;) {
+        _err = u(seeds, &w);
+        iz = w & 127;
+        hz = (int32_t)w >> 7;
+        a = (hz < 0) ? (uint32_t)(-hz) : (uint32_t)hz;
+        x = hz * normW32[iz];
+
+        // rectangular part of the layer
+        if(a < normK32[iz]) {
+            *sample = x;
+            return(_err);
+        }
+
+        // tail beyond NORM_R32, Marsaglia (1964)
+        if(iz == 0) {
+            do {
+                _err = unifrnd32(u, seeds, &f);
+                x = -logf(1.0f - f) / NORM_R32;
+                _err = unifrnd32(u, seeds, &f);
+                y = -logf(1.0f - f);
+            } while(y + y < x * x);
+
+            *sample = (hz > 0) ? NORM_R32 + x : -NORM_R32 - x;
+            return(_err);
+        }
+
+        // wedge
+        _err = unifrnd32(u, seeds, &f);
+        if(normF32[iz] + f * (normF32[iz - 1] - normF32[iz]) < expf(-0.5f * x * x)) {
+            *sample = x;
+            return(_err);
+        }
+    }
+}
+
+
+uint32_t normstdzig64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, double *sample) {
+    uint32_t _err = 0;
+    uint64_t w = 0, a;
+    uint32_t iz;
+    int64_t hz;
+    double x, y, f = 0.0;
+
+    for(;;) {
+        _err = u(seeds, &w);
+        iz = w & 127;
+        hz = (int64_t)w >> 7;
+        a = (hz < 0) ? (uint64_t)(-hz) : (uint64_t)hz;
+        x = hz * normW64[iz];
+
+        // rectangular part of the layer
+        if(a < normK64[iz]) {
+            *sample = x;
+            return(_err);
+        }
+
+        // tail beyond NORM_R64, Marsaglia (1964)
+        if(iz == 0) {
+            do {
+                _err = unifrnd64(u, seeds, &f);
+                x = -log(1.0 - f) / NORM_R64;
+                _err = unifrnd64(u, seeds, &f);
+                y = -log(1.0 - f);
+            } while(y + y < x * x);
+
+            *sample = (hz > 0) ? NORM_R64 + x : -NORM_R64 - x;
+            return(_err);
+        }
+
+        // wedge
+        _err = unifrnd64(u, seeds, &f);
+        if(normF64[iz] + f * (normF64[iz - 1] - normF64[iz]) < exp(-0.5 * x * x)) {
+            *sample = x;
+            return(_err);
+        }
+    }
+}
+
+
+/*
+ * Normal random sample with mean mu and standard deviation sigma
+ */
+uint32_t normzig32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, float *sample, float mu, float sigma) {
+    uint32_t _err = 0;
+    float f = 0.0f;
+
+    _err = normstdzig32(u, seeds, &f);
+
+    *sample = mu + sigma * f;
+
+    return(_err);
+}
+
+
+uint32_t normzig64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, double *sample, double mu, double sigma) {
+    uint32_t _err = 0;
+    double f = 0.0;
+
+    _err = normstdzig64(u, seeds, &f);
+
+    *sample = mu + sigma * f;
+
+    return(_err);
+}
+
+
+/*
+ * Exponential random sample, scaled by lambda like exprnd
+ */
+uint32_t expzig32(uint32_t (*u)(uint32_t *, uint32_t *), uint32_t *seeds, float *sample, float lambda) {
+    uint32_t _err = 0;
+    uint32_t w = 0, iz, jz;
+    float x, f = 0.0f;
+
+    for(;;) {
+        _err = u(seeds, &w);
+        iz = w & 255;
+        jz = w >> 8;
+        x = jz * expW32[iz];
+
+        // rectangular part of the layer
+        if(jz < expK32[iz]) {
+            *sample = x / lambda;
+            return(_err);
+        }
+
+        // tail beyond EXP_R32, memoryless
+        if(iz == 0) {
+            _err = unifrnd32(u, seeds, &f);
+            *sample = (EXP_R32 - logf(1.0f - f)) / lambda;
+            return(_err);
+        }
+
+        // wedge
+        _err = unifrnd32(u, seeds, &f);
+        if(expF32[iz] + f * (expF32[iz - 1] - expF32[iz]) < expf(-x)) {
+            *sample = x / lambda;
+            return(_err);
+        }
+    }
+}
+
+
+uint32_t expzig64(uint32_t (*u)(uint32_t *, uint64_t *), uint32_t *seeds, double *sample, double lambda) {
+    uint32_t _err = 0;
+    uint64_t w = 0, jz;
+    uint32_t iz;
+    double x, f = 0.0;
+
+    for(;;) {
+        _err = u(seeds, &w);
+        iz = w & 255;
+        jz = w >> 8;
+        x = jz * expW64[iz];
+
+        // rectangular part of the layer
+        if(jz < expK64[iz]) {
+            *sample = x / lambda;
+            return(_err);
+        }
+
+        // tail beyond EXP_R64, memoryless
+        if(iz == 0) {
+            _err = unifrnd64(u, seeds, &f);
+            *sample = (EXP_R64 - log(1.0 - f)) / lambda;
+            return(_err);
+        }
+
+        // wedge
+        _err = unifrnd64(u, seeds, &f);
+        if(expF64[iz] + f * (expF64[iz - 1] - expF64[iz]) < exp(-x)) {
+            *sample = x / lambda;
+            return(_err);
+        }
+    }
+}